@@ -0,0 +1,22 @@
+#version 410 core
+
+in vec2 v_TexCoord;
+
+uniform sampler2D u_Source;
+uniform vec2 u_Direction;   // 一個來源像素的偏移 (水平或垂直)
+
+out vec4 fragColor;
+
+// 9-tap 高斯，利用線性過濾把相鄰兩個樣本合成一次取樣 (5 次取樣)
+const float kOffsets[3] = float[](0.0, 1.3846153846, 3.2307692308);
+const float kWeights[3] = float[](0.2270270270, 0.3162162162, 0.0702702703);
+
+void main() {
+    vec4 color = texture(u_Source, v_TexCoord) * kWeights[0];
+    for (int i = 1; i < 3; ++i) {
+        vec2 offset = u_Direction * kOffsets[i];
+        color += texture(u_Source, v_TexCoord + offset) * kWeights[i];
+        color += texture(u_Source, v_TexCoord - offset) * kWeights[i];
+    }
+    fragColor = color;
+}
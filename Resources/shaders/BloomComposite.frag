@@ -0,0 +1,13 @@
+#version 410 core
+
+in vec2 v_TexCoord;
+
+uniform sampler2D u_Bloom;
+uniform float u_Intensity;
+
+out vec4 fragColor;
+
+void main() {
+    // 以加法混合疊到畫面上 (GL_ONE, GL_ONE)
+    fragColor = vec4(texture(u_Bloom, v_TexCoord).rgb * u_Intensity, 1.0);
+}
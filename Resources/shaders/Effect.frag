@@ -0,0 +1,188 @@
+#version 410 core
+
+in vec2 v_TexCoord;
+flat in vec4 v_Color;
+flat in vec4 v_Shape;       // 圓: x=半徑 / 橢圓: xy=半徑 / 矩形: xy=寬高比例, z=粗細, w=旋轉
+flat in vec4 v_FillEdge;    // x: 填充類型, y: 空心粗細, z: 邊緣類型, w: 邊緣寬度
+flat in vec4 v_EdgeColor;
+flat in vec4 v_Animation;   // x: 動畫類型, y: 強度, z: 速度
+flat in float v_Time;
+
+out vec4 fragColor;
+
+// 變體定義由 EffectBatchRenderer 在編譯時插入 (見 Effect::ShaderVariant)，
+// 形狀與修飾器類型都是編譯期常數，用不到的程式碼由前置處理器直接去掉
+#ifndef SHAPE_KIND
+#define SHAPE_KIND 0    // 0=圓形, 1=橢圓, 2=矩形 (對應 ShapeClass)
+#endif
+#ifndef FILL_TYPE
+#define FILL_TYPE 0     // 0=實心, 1=空心
+#endif
+#ifndef EDGE_TYPE
+#define EDGE_TYPE 0     // 0=無邊緣效果, 1=邊緣加深, 2=邊緣發光
+#endif
+#ifndef ANIM_TYPE
+#define ANIM_TYPE 0     // 0=無動畫, 1=波紋 (尾跡由 TrailRenderer 另外畫，這裡不處理)
+#endif
+#ifndef GLOW_PASS
+#define GLOW_PASS 0     // 0=直接提高亮度, 1=bloom 主繪製, 2=bloom 發光貼圖 (對應 GlowPass)
+#endif
+
+#define GLOW_DIRECT 0
+#define GLOW_BLOOM_BASE 1
+#define GLOW_EMISSIVE 2
+
+#define KIND_CIRCLE 0
+#define KIND_ELLIPSE 1
+#define KIND_RECTANGLE 2
+
+// 共用的實例參數
+float edgeWidth;
+float intensity;
+float animSpeed;
+
+// 應用旋轉到坐標
+vec2 rotate2D(vec2 coord, float angle) {
+    float s = sin(angle);
+    float c = cos(angle);
+    mat2 rotMat = mat2(c, -s, s, c);
+    return rotMat * coord;
+}
+
+// 矩形的有號距離 (內部為負)
+float sdBox(vec2 p, vec2 halfDim) {
+    vec2 q = abs(p) - halfDim;
+    return length(max(q, vec2(0.0))) + min(max(q.x, q.y), 0.0);
+}
+
+// 邊緣加深 / 發光
+vec4 applyEdge(vec4 color, float edge) {
+#if EDGE_TYPE == 1 // 邊緣加深
+    color = mix(color, vec4(0.0, 0.0, 0.0, color.a), edge * 0.7);
+#elif EDGE_TYPE == 2 // 邊緣發光
+#if GLOW_PASS == GLOW_EMISSIVE
+    // 只輸出發光量 (預先乘上強度，以加法混合疊加)，亮度交給 bloom 的模糊與合成
+    return vec4(v_EdgeColor.rgb * v_EdgeColor.a * edge, edge);
+#else
+    color = mix(color, v_EdgeColor, edge);
+#if GLOW_PASS == GLOW_DIRECT
+    color.rgb *= 1.0 + edge * 2.0; // 讓邊緣更亮
+#endif
+#endif
+#endif
+    return color;
+}
+
+// 圓形與橢圓共用：dist 為徑向距離場, radius 為邊界所在的距離
+// (橢圓以半徑正規化，邊界在 1.0，粗細也換算成正規化單位)
+vec4 shadeRound(float dist, float radius, float thickness) {
+    // 波紋動畫效果
+#if ANIM_TYPE == 1 // 波紋效果
+    float animEffect = intensity * 0.1 * sin(v_Time * animSpeed * 3.0);
+#else
+    float animEffect = 0.0;
+#endif
+
+    float inner = radius - thickness;
+    float outer = radius;
+
+    // 填充類型處理
+#if FILL_TYPE == 0 // 實心
+    float coverage = 1.0 - smoothstep(outer + animEffect - 0.01, outer + animEffect, dist);
+#else // 空心
+    float coverage = smoothstep(inner + animEffect - 0.01, inner + animEffect, dist) *
+                     (1.0 - smoothstep(outer + animEffect - 0.01, outer + animEffect, dist));
+#endif
+
+    // 丟棄形狀外的區域
+    if (coverage < 0.01) {
+        discard;
+    }
+
+    vec4 finalColor = v_Color;
+
+    // 邊緣效果
+#if EDGE_TYPE > 0
+#if FILL_TYPE == 0 // 實心的邊緣
+    float edge = smoothstep(outer + animEffect - edgeWidth, outer + animEffect, dist);
+#else // 空心的邊緣
+    float innerEdge = smoothstep(inner + animEffect, inner + animEffect + edgeWidth, dist);
+    float outerEdge = smoothstep(outer + animEffect - edgeWidth, outer + animEffect, dist);
+    float edge = innerEdge * (1.0 - outerEdge);
+#endif
+    finalColor = applyEdge(finalColor, edge);
+#endif
+
+    return finalColor;
+}
+
+vec4 shadeRectangle() {
+    // 旋轉坐標
+    vec2 coord = rotate2D(v_TexCoord, v_Shape.w);
+    vec2 halfDim = v_Shape.xy * 0.5;
+
+    // 根據 FillModifier 選擇使用哪種粗細值
+#if FILL_TYPE == 1 // 如果是空心的，使用 FillModifier 的粗細值
+    float thickness = v_FillEdge.y;
+#else
+    float thickness = v_Shape.z;
+#endif
+
+    // 外框距離場 (內部為負)
+    float outerDist = sdBox(coord, halfDim);
+
+    // 對於空心矩形，計算內部邊界
+    vec2 innerHalfDim = halfDim - vec2(thickness);
+    bool insideInner = thickness > 0.0 && innerHalfDim.x > 0.0 && innerHalfDim.y > 0.0 &&
+                       sdBox(coord, innerHalfDim) < 0.0;
+
+    // 根據 FillType 決定是否渲染
+#if FILL_TYPE == 0
+    bool shouldRender = outerDist < 0.0;
+#else
+    bool shouldRender = outerDist < 0.0 && !insideInner;
+#endif
+    if (!shouldRender) {
+        discard;
+    }
+
+    vec4 finalColor = v_Color;
+
+    // 邊緣效果
+#if EDGE_TYPE > 0
+    // 到外框的距離
+    float edgeDist = -outerDist;
+
+    // 內部邊緣
+    if (insideInner) {
+        vec2 innerEdgeDist = abs(coord) - innerHalfDim;
+        edgeDist = min(edgeDist, min(innerEdgeDist.x, innerEdgeDist.y));
+    }
+
+    finalColor = applyEdge(finalColor, 1.0 - smoothstep(0.0, edgeWidth, edgeDist));
+#endif
+
+    // 波紋動畫效果
+#if ANIM_TYPE == 1
+    float wave = sin(v_Time * animSpeed * 3.0);
+    wave = wave * 0.5 + 0.5; // 轉換到 0-1 範圍
+    finalColor.rgb *= 1.0 + wave * intensity * 0.2;
+#endif
+
+    return finalColor;
+}
+
+void main() {
+    edgeWidth = v_FillEdge.w;
+    intensity = v_Animation.y;
+    animSpeed = v_Animation.z;
+
+#if SHAPE_KIND == KIND_CIRCLE
+    fragColor = shadeRound(length(v_TexCoord), v_Shape.x, v_FillEdge.y);
+#elif SHAPE_KIND == KIND_ELLIPSE
+    vec2 radii = v_Shape.xy;
+    fragColor = shadeRound(length(v_TexCoord / radii), 1.0, v_FillEdge.y / min(radii.x, radii.y));
+#else
+    fragColor = shadeRectangle();
+#endif
+}
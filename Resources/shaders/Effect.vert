@@ -0,0 +1,123 @@
+#version 410 core
+
+// 實心：單位四邊形的位置與 UV
+// 空心：環狀網格 (EffectBatchRenderer 的 outline mesh)，position 為方向 (圓 / 橢圓，外圈已放大到外接多邊形)
+//       或角落的符號 (矩形)，texCoord.x 為 0=內圈、1=外圈
+layout(location = 0) in vec2 position;
+layout(location = 1) in vec2 texCoord;
+
+// 實例屬性 (對應 Effect::EffectInstance)
+layout(location = 2) in vec4 a_Transform;   // xy: 中心位置, zw: 畫布大小
+layout(location = 3) in vec4 a_Params;      // x: 旋轉, y: z-index, z: 已播放時間, w: 形狀種類
+layout(location = 4) in vec4 a_Color;
+layout(location = 5) in vec4 a_Shape;
+layout(location = 6) in vec4 a_FillEdge;
+layout(location = 7) in vec4 a_EdgeColor;
+layout(location = 8) in vec4 a_Animation;
+layout(location = 9) in vec4 a_Motion;      // xy: 速度(像素/秒), z: 最大距離, w: 1=移動中
+
+uniform mat4 u_Projection;
+
+out vec2 v_TexCoord;
+flat out vec4 v_Color;
+flat out vec4 v_Shape;
+flat out vec4 v_FillEdge;
+flat out vec4 v_EdgeColor;
+flat out vec4 v_Animation;
+flat out float v_Time;
+
+// SHAPE_KIND 等變體定義由 EffectBatchRenderer 在編譯時插入 (見 Effect::ShaderVariant)
+#ifndef SHAPE_KIND
+#define SHAPE_KIND 0
+#endif
+#ifndef FILL_TYPE
+#define FILL_TYPE 0
+#endif
+#ifndef ANIM_TYPE
+#define ANIM_TYPE 0
+#endif
+
+// 直線移動的封閉解：從起點沿速度方向前進，最多到最大距離
+// (與 MovementModifier::Evaluate 相同)
+vec2 evaluateMotion(vec2 start, float elapsed) {
+    if (a_Motion.w < 0.5) {
+        return start;
+    }
+    float speed = length(a_Motion.xy);
+    if (speed <= 0.0) {
+        return start;
+    }
+    return start + a_Motion.xy / speed * min(speed * elapsed, a_Motion.z);
+}
+
+#define KIND_CIRCLE 0
+#define KIND_ELLIPSE 1
+#define KIND_RECTANGLE 2
+
+// 長條坐標轉回畫布坐標 (Effect.frag 以 rotate2D(coord, w) 轉回長條坐標，這裡做反向旋轉)
+vec2 unrotateBox(vec2 boxCoord) {
+    float s = sin(a_Shape.w);
+    float c = cos(a_Shape.w);
+    return vec2(c * boxCoord.x - s * boxCoord.y, s * boxCoord.x + c * boxCoord.y);
+}
+
+#if FILL_TYPE == 1
+// 環的內外半徑需多留的寬度：Effect.frag 的反鋸齒 (0.01) 加上波紋讓邊界移動的幅度
+float ringMargin() {
+#if ANIM_TYPE == 1
+    return 0.01 + abs(a_Animation.y) * 0.1;
+#else
+    return 0.01;
+#endif
+}
+#endif
+
+// 畫布坐標 (以中心為原點，範圍 -0.5 ~ 0.5，y 向下，與 Effect.frag 的 v_TexCoord 相同)
+vec2 canvasCoord() {
+#if FILL_TYPE == 1 && SHAPE_KIND == KIND_CIRCLE
+    // 空心圓只畫內外半徑之間的環，不畫整個畫布
+    float outer = a_Shape.x + ringMargin();
+    float inner = max(a_Shape.x - a_FillEdge.y - ringMargin(), 0.0);
+    return position * mix(inner, outer, texCoord.x);
+#elif FILL_TYPE == 1 && SHAPE_KIND == KIND_ELLIPSE
+    // 空心橢圓：在以半徑正規化的空間 (邊界在 1.0) 建環再拉伸，與 Effect.frag 的距離場一致
+    vec2 radii = a_Shape.xy;
+    float thickness = a_FillEdge.y / min(radii.x, radii.y);
+    float outer = 1.0 + ringMargin();
+    float inner = max(1.0 - thickness - ringMargin(), 0.0);
+    return position * mix(inner, outer, texCoord.x) * radii;
+#elif FILL_TYPE == 1
+    // 空心矩形只畫外框與內框之間的框 (Effect.frag 在外框外與內框內都會丟棄)
+    vec2 halfDim = a_Shape.xy * 0.5;
+    vec2 innerHalfDim = a_FillEdge.y > 0.0 ? max(halfDim - vec2(a_FillEdge.y), vec2(0.0)) : vec2(0.0);
+    return unrotateBox(position * mix(innerHalfDim, halfDim + vec2(0.001), texCoord.x));
+#elif SHAPE_KIND != KIND_RECTANGLE
+    // 實心圓形與橢圓填滿整個畫布
+    return texCoord - vec2(0.5, 0.5);
+#else
+    // 矩形只畫剛好包住旋轉後長條 (加上邊緣寬度) 的四邊形，
+    // 而不是整個正方形畫布，片段數量與長條面積成正比
+    vec2 extent = a_Shape.xy + vec2(2.0 * a_FillEdge.w);
+    return unrotateBox(vec2(position.x, -position.y) * extent);
+#endif
+}
+
+void main() {
+    // 縮放到畫布大小後旋轉，再平移到中心位置
+    vec2 uv = canvasCoord();
+    vec2 local = vec2(uv.x, -uv.y) * a_Transform.zw;
+    float s = sin(a_Params.x);
+    float c = cos(a_Params.x);
+    vec2 center = evaluateMotion(a_Transform.xy, a_Params.z);
+    vec2 world = center + vec2(c * local.x - s * local.y, s * local.x + c * local.y);
+
+    gl_Position = u_Projection * vec4(world, a_Params.y, 1.0);
+    v_TexCoord = uv;
+
+    v_Color = a_Color;
+    v_Shape = a_Shape;
+    v_FillEdge = a_FillEdge;
+    v_EdgeColor = a_EdgeColor;
+    v_Animation = a_Animation;
+    v_Time = a_Params.z;
+}
@@ -0,0 +1,10 @@
+#version 410 core
+
+// 全螢幕三角形，不需要頂點緩衝 (以 gl_VertexID 產生 3 個頂點)
+out vec2 v_TexCoord;
+
+void main() {
+    vec2 uv = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+    v_TexCoord = uv;
+    gl_Position = vec4(uv * 2.0 - 1.0, 0.0, 1.0);
+}
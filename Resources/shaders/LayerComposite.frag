@@ -0,0 +1,12 @@
+#version 410 core
+
+in vec2 v_TexCoord;
+
+uniform sampler2D u_Layer;
+
+out vec4 fragColor;
+
+void main() {
+    // 圖層內是預乘 alpha 的顏色，線性過濾放大後以 (GL_ONE, GL_ONE_MINUS_SRC_ALPHA) 疊到畫面上
+    fragColor = texture(u_Layer, v_TexCoord);
+}
@@ -0,0 +1,33 @@
+#version 410 core
+
+in vec2 v_TexCoord;
+
+uniform sampler2D u_Mask;
+uniform vec2 u_TexelSize;
+uniform vec4 u_FillColor;
+uniform vec4 u_EdgeColor;
+
+out vec4 fragColor;
+
+// 覆蓋率的變化量放大成邊緣強度
+const float kEdgeGain = 4.0;
+
+void main() {
+    // 遮罩是所有形狀中最大的覆蓋率 (已含各自的 alpha)，重疊處不會越疊越深
+    float coverage = texture(u_Mask, v_TexCoord).r;
+
+    // 相鄰像素的差當作輪廓：重疊的內部沒有變化，只有整體的外緣發光
+    float left = texture(u_Mask, v_TexCoord - vec2(u_TexelSize.x, 0.0)).r;
+    float right = texture(u_Mask, v_TexCoord + vec2(u_TexelSize.x, 0.0)).r;
+    float down = texture(u_Mask, v_TexCoord - vec2(0.0, u_TexelSize.y)).r;
+    float up = texture(u_Mask, v_TexCoord + vec2(0.0, u_TexelSize.y)).r;
+    float edge = clamp(length(vec2(right - left, up - down)) * kEdgeGain, 0.0, 1.0) * u_EdgeColor.a;
+
+    float fill = coverage * u_FillColor.a;
+    float alpha = max(fill, edge);
+    if (alpha < 0.004) {
+        discard;
+    }
+    // 以 (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA) 疊到畫面上 (或降解析度特效圖層)
+    fragColor = vec4(mix(u_FillColor.rgb, u_EdgeColor.rgb, edge / alpha), alpha);
+}
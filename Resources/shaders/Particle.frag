@@ -0,0 +1,16 @@
+#version 410 core
+
+in vec2 v_TexCoord;
+flat in vec4 v_Color;
+
+out vec4 fragColor;
+
+void main() {
+    // 柔邊圓點
+    float dist = length(v_TexCoord) * 2.0;
+    float alpha = v_Color.a * (1.0 - smoothstep(0.5, 1.0, dist));
+    if (alpha < 0.01) {
+        discard;
+    }
+    fragColor = vec4(v_Color.rgb, alpha);
+}
@@ -0,0 +1,20 @@
+#version 410 core
+
+layout(location = 0) in vec2 position;
+layout(location = 1) in vec2 texCoord;
+
+// 實例屬性 (對應 Effect::ParticleInstance)
+layout(location = 2) in vec4 a_PositionSize;   // xy: 位置(像素), z: 大小(像素), w: z-index
+layout(location = 3) in vec4 a_Color;
+
+uniform mat4 u_Projection;
+
+out vec2 v_TexCoord;
+flat out vec4 v_Color;
+
+void main() {
+    vec2 world = a_PositionSize.xy + position * a_PositionSize.z;
+    gl_Position = u_Projection * vec4(world, a_PositionSize.w, 1.0);
+    v_TexCoord = texCoord - vec2(0.5, 0.5); // 將UV坐標移到中心
+    v_Color = a_Color;
+}
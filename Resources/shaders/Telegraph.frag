@@ -0,0 +1,22 @@
+#version 410 core
+
+in vec2 v_TexCoord;
+
+uniform sampler2D u_Atlas;
+
+out vec4 fragColor;
+
+void main() {
+    // 貼圖集存的是預乘 alpha 的顏色 (線性過濾才不會在邊緣混入黑色)，
+    // 還原成一般的顏色後沿用特效的 (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA) 混合
+    vec4 color = texture(u_Atlas, v_TexCoord);
+    if (color.a < 0.004) {
+        discard;
+    }
+#ifdef COVERAGE_OUTPUT
+    // 預警遮罩 (R8)：只寫覆蓋率，顏色在合成時統一套用
+    fragColor = vec4(color.a);
+#else
+    fragColor = vec4(color.rgb / color.a, color.a);
+#endif
+}
@@ -0,0 +1,24 @@
+#version 410 core
+
+// 烘焙好的靜態特效 (預警範圍)：單位四邊形貼上貼圖集中的一塊
+layout(location = 0) in vec2 position;
+
+// 實例屬性 (與 Effect.vert 共用 Effect::EffectInstance 的排列，只用到其中三個)
+layout(location = 2) in vec4 a_Transform;   // xy: 中心位置, zw: 外觀大小(像素)
+layout(location = 3) in vec4 a_Params;      // x: 旋轉, y: z-index
+layout(location = 5) in vec4 a_Region;      // 貼圖集中的 UV 範圍 (u0, v0, u1, v1)
+
+uniform mat4 u_Projection;
+
+out vec2 v_TexCoord;
+
+void main() {
+    vec2 local = position * a_Transform.zw;
+    float s = sin(a_Params.x);
+    float c = cos(a_Params.x);
+    vec2 world = a_Transform.xy + vec2(c * local.x - s * local.y, s * local.x + c * local.y);
+
+    gl_Position = u_Projection * vec4(world, a_Params.y, 1.0);
+    // 烘焙時以 y 向上的像素坐標畫進貼圖集，四邊形的上緣對應區塊的 v1
+    v_TexCoord = mix(a_Region.xy, a_Region.zw, position + vec2(0.5));
+}
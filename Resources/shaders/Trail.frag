@@ -0,0 +1,15 @@
+#version 410 core
+
+in float v_Side;
+in vec4 v_Color;
+
+out vec4 fragColor;
+
+void main() {
+    // 帶狀的中央最亮，往兩側柔和淡出
+    float alpha = v_Color.a * (1.0 - smoothstep(0.3, 1.0, abs(v_Side)));
+    if (alpha < 0.01) {
+        discard;
+    }
+    fragColor = vec4(v_Color.rgb, alpha);
+}
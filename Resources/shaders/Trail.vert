@@ -0,0 +1,15 @@
+#version 410 core
+
+layout(location = 0) in vec4 a_PositionSide;   // xy: 位置(像素), z: z-index, w: 在哪一側 (-1 / 1)
+layout(location = 1) in vec4 a_Color;
+
+uniform mat4 u_Projection;
+
+out float v_Side;
+out vec4 v_Color;
+
+void main() {
+    gl_Position = u_Projection * vec4(a_PositionSide.xy, a_PositionSide.z, 1.0);
+    v_Side = a_PositionSide.w;
+    v_Color = a_Color;
+}
@@ -3,7 +3,7 @@
 
 #include "pch.hpp" // IWYU pragma: export
 
-#include "Util/Renderer.hpp"
+#include "Render/SceneRenderer.hpp"
 #include "Character.hpp"
 #include "Enemy.hpp"
 #include "PhaseManger.hpp" // 階段資源管理
@@ -88,7 +88,7 @@ private:
     // int m_SubPhaseIndex = 0;                           // 當前小關索引 (0-4)
     // SubPhase m_CurrentSubPhase = SubPhase::BATTLE;     // 當前小關類型
 
-    Util::Renderer m_Root;
+    Render::SceneRenderer m_Root;   // 場景與特效一起經由 DrawQueue 依 z 排序繪製
     std::shared_ptr<PhaseManager> m_PRM; // 階段資源管理器
     std::shared_ptr<EnemyAttackController> m_EnemyAttackController; // 敵人攻擊控制器
     std::shared_ptr<Character> m_Rabbit;               // 定義兔子
@@ -123,6 +123,10 @@ private:
     bool m_IsReady = false;
     int m_CurrentPausedOption = 0;
     Phase m_Phase;
+
+    // 啟動時間：App 建立 (GL context 已存在) 到第一次 Update 的時間
+    std::chrono::steady_clock::time_point m_LaunchTime = std::chrono::steady_clock::now();
+    bool m_FirstFrameLogged = false;
 };
 
 #endif
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "Util/Color.hpp"
 #include "Util/Text.hpp"
 #include "Effect/CompositeEffect.hpp"
+#include "Effect/EffectLease.hpp"
 #include "Character.hpp"
 #include <memory>
 
@@ -49,8 +50,8 @@ public:
     float GetAttackDuration() const { return m_AttackDuration; }
 
     // 獲取特效
-    [[nodiscard]] std::shared_ptr<Effect::CompositeEffect> GetWarningEffect() const { return m_WarningEffect; }
-    [[nodiscard]] std::shared_ptr<Effect::CompositeEffect> GetAttackEffect() const { return m_AttackEffect; }
+    [[nodiscard]] Effect::CompositeEffect* GetWarningEffect() const { return m_WarningEffect.Get(); }
+    [[nodiscard]] Effect::CompositeEffect* GetAttackEffect() const { return m_AttackEffect.Get(); }
     virtual void CleanupVisuals() {};
 
 
@@ -86,10 +87,11 @@ protected:
 
     std::shared_ptr<Character> m_TargetCharacter = nullptr;
 
-    // 視覺元素
-    std::shared_ptr<Effect::CompositeEffect> m_WarningEffect;
-    std::shared_ptr<Effect::CompositeEffect> m_AttackEffect;
-    std::shared_ptr<Effect::CompositeEffect> m_TimeBarEffect;
+    // 視覺元素 (特效由 EffectManager 持有)
+    // (以租約持有，攻擊解構或 Release 時特效立即回到對象池)
+    Effect::EffectLease m_WarningEffect;
+    Effect::EffectLease m_AttackEffect;
+    Effect::EffectLease m_TimeBarEffect;
     std::shared_ptr<Util::Text> m_SequenceText;
     std::shared_ptr<Util::GameObject> m_SequenceTextObject;
 
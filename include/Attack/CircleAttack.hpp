@@ -61,6 +61,7 @@ protected:
     void SyncWithEffect() override;
     void OnCountdownStart() override;
     void OnAttackStart() override;
+    void OnAttackUpdate(float deltaTime) override;
 
 private:
     float m_Radius;                // 圓形攻擊半徑
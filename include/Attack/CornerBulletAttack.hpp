@@ -2,6 +2,7 @@
 #define CORNERBULLETATTACK_HPP
 
 #include "Attack/CircleAttack.hpp"
+#include "Effect/EffectManager.hpp"
 #include <vector>
 #include <random>
 
@@ -32,7 +33,7 @@ private:
         glm::vec2 startPosition;      // 發射起點
         glm::vec2 currentPosition;    // 當前位置 (用於碰撞檢測)
         float angle;                  // 發射角度（弧度）
-        std::shared_ptr<Effect::CompositeEffect> warningEffect;  // 軌跡警告效果
+        Effect::EffectLease warningEffect;  // 軌跡警告效果
         std::shared_ptr<CircleAttack> bulletAttack;   // 子彈攻擊 (使用 CircleAttack)
         bool isActive = false;        // 子彈是否活躍
     };
@@ -42,6 +43,10 @@ private:
     int m_BulletCount = 3;                   // 每個角落的子彈數量
     std::default_random_engine m_RandomEngine;// 隨機數生成器
     std::vector<std::shared_ptr<CircleAttack>> m_BulletAttacks; // 存儲所有子彈攻擊實例
+
+    // 批次生成警告效果用的暫存 (重複使用，不每次配置)
+    std::vector<Effect::EffectManager::Spawn> m_WarningSpawns;
+    std::vector<Effect::EffectHandle> m_WarningHandles;
 };
 
 #endif // CORNERBULLETATTACK_HPP
\ No newline at end of file
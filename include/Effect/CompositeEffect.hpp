@@ -1,6 +1,7 @@
 #ifndef COMPOSITEEFFECT_HPP
 #define COMPOSITEEFFECT_HPP
 
+#include <variant>
 #include "Effect/Shape/CircleShape.hpp"
 #include "Effect/Shape/EllipseShape.hpp"
 #include "Effect/Shape/RectangleShape.hpp"
@@ -8,50 +9,117 @@
 #include "Effect/Modifier/EdgeModifier.hpp"
 #include "Effect/Modifier/MovementModifier.hpp"
 #include "Effect/Modifier/AnimationModifier.hpp"
+#include "Effect/ShaderVariant.hpp"
+#include "Util/Transform.hpp"
 
 namespace Effect {
 
-    // 組合所有修飾器的特效類
-    class CompositeEffect : public IEffect {
+    // 封閉的形狀集合，順序需與 ShapeClass 一致
+    using ShapeVariant = std::variant<Shape::CircleShape, Shape::EllipseShape, Shape::RectangleShape>;
+    static_assert(std::variant_size_v<ShapeVariant> == static_cast<size_t>(ShapeClass::COUNT),
+                  "ShapeVariant must list every ShapeClass in order");
+
+    // 組合所有修飾器的特效類 (值型別：形狀與修飾器都直接存放在物件內)
+    class CompositeEffect final {
     public:
-        // 建構函數基於形狀類型
-        CompositeEffect(const std::shared_ptr<Shape::BaseShape>& baseShape);
-        ~CompositeEffect() override = default;
+        enum class State {
+            INACTIVE,   // 未激活（可用於對象池回收）
+            ACTIVE,     // 活躍中
+            FINISHED    // 已結束（可以被回收）
+        };
+
+        // 建構函數基於形狀
+        explicit CompositeEffect(const ShapeVariant& shape, float duration = 1.0f);
+
+        // 生命週期管理
+        void Update(float deltaTime);
+        void Play(const glm::vec2& position, float zIndex = 0.0f);
+        void Reset();
+
+        // 狀態訪問
+        State GetState() const { return m_State; }
+        bool IsFinished() const { return m_State == State::FINISHED; }
+        bool IsActive() const { return m_State == State::ACTIVE; }
+
+        // 獲取和設置位置
+        glm::vec2 GetPosition() const;  // 移動中的特效依播放時間計算 (碰撞用)
+        void SetPosition(const glm::vec2& position) {
+            m_Transform.translation = position;
+            m_MovementModifier.SetStartPosition(position);
+        }
+
+        // 特效持續時間
+        float GetDuration() const { return m_Duration; }
+        float GetElapsedTime() const { return m_ElapsedTime; }
+        void SetDuration(float duration) { m_Duration = duration; }
+
+        // 剔除用：以目前位置為中心、包住所有可能有顏色的像素的半徑 (像素，含邊緣與波紋)
+        float GetBoundingRadius() const;
+        // 目前的速度 (像素/秒)；不移動或已到終點時為 0
+        glm::vec2 GetVelocity() const;
+        bool IsMoving() const { return m_MovementModifier.IsMoving(); }
 
-        // 實現自Core::Drawable
-        void Draw(const Core::Matrices& data) override;
-        glm::vec2 GetSize() const override;
+        float GetZIndex() const { return m_ZIndex; }
+        glm::vec2 GetSize() const;
+        void SetSize(const glm::vec2& size);  // 形狀的畫布大小 (像素)
 
-        // 實現自Effect::IEffect
-        void Update(float deltaTime) override;
-        void Play(const glm::vec2& position, float zIndex = 0.0f) override;
-        void Reset() override;
+        // 批次繪製：輸出此特效的實例資料
+        void WriteInstance(EffectInstance& instance) const;
+        ShapeClass GetShapeClass() const { return static_cast<ShapeClass>(m_Shape.index()); }
+        // 形狀與修飾器組合對應的著色器變體 (尾跡另外畫，本體用無動畫的變體)
+        ShaderVariant GetShaderVariant() const {
+            const auto animation = HasTrail() ? Modifier::AnimationType::NONE : m_AnimationModifier.GetAnimationType();
+            return {GetShapeClass(), m_FillModifier.GetFillType(), m_EdgeModifier.GetEdgeType(), animation};
+        }
+
+        // 尾跡：動畫類型為 TRAIL 的特效記錄走過的位置，由 TrailRenderer 畫成帶狀
+        bool HasTrail() const { return m_AnimationModifier.GetAnimationType() == Modifier::AnimationType::TRAIL; }
+        float GetTrailWidth() const;  // 約等於形狀本身的寬度 (像素)
+
+        // 烘焙：標記為可烘焙 (資料檔的 bake) 且確實靜止的特效，以貼圖集中烘焙好的外觀繪製
+        void SetBakeable(bool bakeable) { m_Bakeable = bakeable; }
+        bool IsBakeable() const;
+        // 預警範圍 (資料檔的 telegraph)：烘焙後併入預警遮罩，與其他預警一起上色
+        void SetTelegraph(bool telegraph) { m_Telegraph = telegraph; }
+        bool IsTelegraph() const { return m_Telegraph; }
+
+        // 形狀存取：形狀不符時回傳 nullptr
+        void SetShape(const ShapeVariant& shape) { m_Shape = shape; }
+        template <typename T>
+        T* GetShape() { return std::get_if<T>(&m_Shape); }
+        template <typename T>
+        const T* GetShape() const { return std::get_if<T>(&m_Shape); }
+
+        // 顏色設置
+        void SetColor(const Util::Color& color) { m_Color = color; }
+        const Util::Color& GetColor() const { return m_Color; }
 
         // 修飾器設置
         void SetFillModifier(const Modifier::FillModifier& modifier) { m_FillModifier = modifier; }
         void SetEdgeModifier(const Modifier::EdgeModifier& modifier) { m_EdgeModifier = modifier; }
         void SetMovementModifier(const Modifier::MovementModifier& modifier) { m_MovementModifier = modifier; }
         void SetAnimationModifier(const Modifier::AnimationModifier& modifier) { m_AnimationModifier = modifier; }
+        const Modifier::EdgeModifier& GetEdgeModifier() const { return m_EdgeModifier; }
 
-        void SetDuration(float duration) override {
-            m_Duration = duration;
-            if (m_BaseShape) {
-                m_BaseShape->SetDuration(duration);
-            }
-        }
-
-        // 基礎形狀設置
-        std::shared_ptr<Shape::BaseShape> GetBaseShape() { return m_BaseShape; }
         void SetDirection(float direction) { m_direction = direction; }
         float GetDirection() { return m_direction; }
 
     private:
-        std::shared_ptr<Shape::BaseShape> m_BaseShape;
+        ShapeVariant m_Shape;
+        Util::Color m_Color = Util::Color::FromName(Util::Colors::PINK);
         Modifier::FillModifier m_FillModifier;
         Modifier::EdgeModifier m_EdgeModifier;
         Modifier::MovementModifier m_MovementModifier;
         Modifier::AnimationModifier m_AnimationModifier;
         float m_direction = 1.0f;
+        bool m_Bakeable = false;
+        bool m_Telegraph = false;
+
+        State m_State = State::INACTIVE;
+        Util::Transform m_Transform;
+        float m_Duration = 1.0f;         // 特效持續時間（秒）
+        float m_ElapsedTime = 0.0f;      // 已經過的時間（秒）
+        float m_ZIndex = 0.0f;           // Z-index 用於繪製順序
     };
 
 } // namespace Effect
@@ -0,0 +1,234 @@
+#ifndef EFFECT_BATCH_RENDERER_HPP
+#define EFFECT_BATCH_RENDERER_HPP
+
+#include "Effect/EffectInstance.hpp"
+#include "Effect/ShaderVariant.hpp"
+#include "Core/VertexArray.hpp"
+#include "Render/ShaderPermutations.hpp"
+#include "Render/BloomPass.hpp"
+#include "Render/CoverageMask.hpp"
+#include "Render/ScaledLayer.hpp"
+#include "Render/ShaderProgram.hpp"
+#include "Render/TextureAtlas.hpp"
+#include "Render/UniformTable.hpp"
+#include "Render/StreamBuffer.hpp"
+#include "Render/DrawQueue.hpp"
+
+namespace Effect {
+
+    // 特效批次繪製器：特效收集成實例資料，經由 DrawQueue 依 z 與其他物件穿插，
+    // 排序後相鄰且著色器變體、網格相同的特效一次 glDrawElementsInstanced 畫完。
+    // 實心特效畫四邊形；空心特效畫只覆蓋環 / 框的網格，大型預警圈不必跑整個外接正方形。
+    // 靜態的特效 (預警範圍) 第一次出現時把外觀烘焙進貼圖集，之後只畫貼圖四邊形，不再跑 SDF
+    class EffectBatchRenderer : public Render::DrawSource {
+    public:
+        static EffectBatchRenderer& GetInstance() {
+            static EffectBatchRenderer instance;
+            return instance;
+        }
+
+        EffectBatchRenderer(const EffectBatchRenderer&) = delete;
+        EffectBatchRenderer& operator=(const EffectBatchRenderer&) = delete;
+
+        // 特效的繪製方式 (EffectManager 依特效的設定選擇)
+        enum class DrawPath : uint8_t {
+            LIVE,       // 每幀跑 SDF
+            BAKED,      // 靜止的外觀：畫貼圖集中烘焙好的一塊
+            TELEGRAPH,  // 預警範圍：烘焙後累積到預警遮罩，所有預警一次合成 (遮罩關閉時同 BAKED)
+        };
+
+        // 開始新的一幀，清空實例
+        void Begin();
+
+        // 加入一個特效實例並送進繪製佇列 (變體編號與網格放在排序鍵的材質欄位，同 z 的同變體會排在一起)。
+        // BAKED / TELEGRAPH 只用於不移動、不旋轉、沒有動畫的特效
+        void Submit(const EffectInstance& instance, const ShaderVariant& variant, Render::DrawQueue& queue,
+                    DrawPath path = DrawPath::LIVE);
+
+        // 所有特效送出之後呼叫：送出預警遮罩、bloom 與降解析度圖層的合成
+        void EndSubmit(Render::DrawQueue& queue);
+
+        // 預先編譯變體，避免第一次出現時才編譯造成卡頓
+        void Prepare(const ShaderVariant& variant);
+
+        // Bloom 後處理：開啟時發光邊緣改由一次全畫面模糊合成，
+        // 特效著色器內不再提高邊緣亮度 (需在 Prepare 之前設定，變體才會一起預先編譯)
+        void SetBloomEnabled(bool enabled);
+        bool IsBloomEnabled() const { return m_BloomEnabled; }
+        Render::BloomPass* GetBloomPass() { return m_Bloom.get(); }
+
+        // 關閉發光 (品質調降)：發光邊緣只混入顏色，不提高亮度也不做 bloom
+        void SetGlowEnabled(bool enabled) { m_GlowEnabled = enabled; }
+        bool IsGlowEnabled() const { return m_GlowEnabled; }
+
+        // 特效圖層的解析度比例 (1 = 直接畫在畫面上，0.5 / 0.25 = 半 / 四分之一解析度)，可在執行中改變。
+        // 小於 1 時特效畫在離屏圖層，在最高的特效 z 一次放大疊回，不再與中間的場景物件穿插
+        void SetLayerScale(float scale) { m_LayerScale = std::clamp(scale, 0.125f, 1.0f); }
+        float GetLayerScale() const { return m_LayerScale; }
+        // 品質調降：至少使用半解析度
+        void SetReducedResolution(bool reduced) { m_ReducedResolution = reduced; }
+        float GetEffectiveLayerScale() const {
+            return m_ReducedResolution ? std::min(m_LayerScale, kReducedLayerScale) : m_LayerScale;
+        }
+
+        // 預警遮罩：TELEGRAPH 的特效不各自混合，而是以 max 累積到半解析度的覆蓋率遮罩
+        // (Render/CoverageMask)，在最高的預警 z 以一組填充與邊緣顏色一次合成。
+        // 重疊再多，上色與混合都只有一次全畫面的成本；開啟時預警不再與中間的物件穿插
+        void SetTelegraphMaskEnabled(bool enabled) { m_TelegraphMaskEnabled = enabled; }
+        bool IsTelegraphMaskEnabled() const { return m_TelegraphMaskEnabled; }
+        // 填充顏色的 alpha 乘上遮罩的覆蓋率 (已含各預警自己的 alpha)；邊緣顏色的 alpha 為發光強度。
+        // EffectManager::Initialize 以資料檔中第一個 telegraph 原型的 color 與 edge 顏色設定
+        void SetTelegraphColors(const glm::vec4& fill, const glm::vec4& edge) {
+            m_TelegraphFill = fill;
+            m_TelegraphEdge = edge;
+        }
+
+        // DrawQueue 依排序結果呼叫：一段相鄰的特效一次畫完
+        void DrawRun(const uint32_t* payloads, size_t count) override;
+        void EndFrame() override;
+
+        // 本幀發出的 draw call 數與實例數
+        size_t GetDrawCallCount() const { return m_DrawCallCount; }
+        size_t GetInstanceCount() const { return m_InstanceCount; }
+        // 已編譯的著色器變體數
+        size_t GetVariantCount() const { return m_Shaders ? m_Shaders->GetSize() : 0; }
+        // 貼圖集中已烘焙的外觀數與本幀烘焙的次數
+        size_t GetBakedLookCount() const { return m_Atlas ? m_Atlas->GetEntryCount() : 0; }
+        size_t GetBakeCount() const { return m_BakeCount; }
+
+    private:
+        EffectBatchRenderer();
+        ~EffectBatchRenderer() override;
+
+        struct VariantProgram {
+            GLuint program = 0;
+            std::unique_ptr<Render::UniformTable> uniforms;
+            Render::UniformTable::Id projection = Render::UniformTable::kInvalid;
+        };
+
+        // 實例使用的網格
+        enum class Geometry : uint8_t {
+            QUAD,       // 實心：四邊形
+            FRAME,      // 空心矩形：外框與內框之間
+            RING_16,    // 空心圓 / 橢圓：內外半徑之間的環，依畫面上的半徑選分段數
+            RING_32,
+            RING_64,
+            RING_128,
+            SPRITE,     // 烘焙好的靜態特效：四邊形貼上貼圖集中的一塊
+            COUNT
+        };
+
+        struct MeshRange {
+            GLsizei indexCount = 0;
+            size_t firstIndex = 0;
+        };
+
+        // 批次編號：低 8 位元為變體編號，高位元為網格；同一次繪製的實例兩者都相同
+        static constexpr uint16_t kVariantBits = 8;
+        static constexpr uint16_t kVariantMask = (1u << kVariantBits) - 1;
+        static_assert(ShaderVariant::kCount <= kVariantMask + 1, "variant keys must fit in the batch key");
+        static uint16_t MakeBatchKey(uint16_t variantKey, Geometry geometry) {
+            return static_cast<uint16_t>(variantKey | static_cast<uint16_t>(geometry) << kVariantBits);
+        }
+
+        void InitializeResources();
+        void InitializeOutlineMeshes();
+
+        Geometry SelectGeometry(const EffectInstance& instance, const ShaderVariant& variant) const;
+
+        // 取得 (必要時編譯) 變體的程式；編譯失敗回傳 nullptr
+        const VariantProgram* GetProgram(uint16_t key);
+        // 換成批次使用的程式 (烘焙外觀用貼圖程式)；沒有可用的程式時回傳 false
+        bool UseBatchProgram(uint16_t key);
+
+        // 靜態特效改畫貼圖：找到 (或烘焙) 外觀後寫出貼圖實例；無法烘焙時回傳 false，照常畫 SDF
+        bool MakeSprite(const EffectInstance& instance, const ShaderVariant& variant, Geometry geometry,
+                        EffectInstance& sprite);
+        // 把外觀 (已去掉位置、z 與時間的實例) 畫進貼圖集的一塊，回傳 UV 範圍
+        const glm::vec4* Bake(EffectInstance look, uint16_t variantKey, Geometry geometry,
+                              const glm::vec2& extent, uint64_t lookKey);
+
+        void BeginStream();
+        // 一段相鄰的特效 (不含圖層合成)
+        void DrawInstances(const uint32_t* payloads, size_t count);
+        // 上傳 m_RunInstances 並依 m_RunBatches 分段繪製
+        void DrawUploaded();
+        // 畫發光量、模糊並合成
+        void DrawBloom();
+        // 預警累積到遮罩後上色合成
+        void DrawTelegraphMask();
+
+        // SDF 特效著色器的各個變體，依 ShaderVariant::GetKey() 索引
+        std::unique_ptr<Render::ShaderPermutations> m_Shaders;
+        std::array<VariantProgram, ShaderVariant::kCount> m_Programs;
+
+        std::vector<EffectInstance> m_Instances;     // 送出順序
+        std::vector<uint16_t> m_InstanceBatches;     // 與 m_Instances 對應的批次編號
+        std::vector<EffectInstance> m_RunInstances;  // 一段的排序後實例 (上傳用)
+        std::vector<uint16_t> m_RunBatches;
+
+        // bloom 的發光量 (只有發光邊緣的特效)
+        bool m_BloomEnabled = false;
+        bool m_GlowEnabled = true;
+        std::unique_ptr<Render::BloomPass> m_Bloom;
+        std::vector<EffectInstance> m_EmissiveInstances;
+        std::vector<uint16_t> m_EmissiveBatches;
+        std::vector<uint32_t> m_EmissiveOrder;
+        float m_EmissiveMaxZ = 0.0f;    // 本幀最高的發光特效 z (bloom 合成的位置)
+
+        // 降解析度的特效圖層
+        static constexpr float kReducedLayerScale = 0.5f;
+        static constexpr uint32_t kLayerCompositePayload = UINT32_MAX;  // 佇列中代表圖層合成的項目
+        static constexpr uint32_t kMaskCompositePayload = UINT32_MAX - 1;  // 佇列中代表預警遮罩合成的項目
+        static constexpr uint32_t kBloomCompositePayload = UINT32_MAX - 2;  // 佇列中代表 bloom 合成的項目 (最小的特殊項目)
+        float m_LayerScale = 1.0f;
+        bool m_ReducedResolution = false;
+        bool m_LayerActive = false;     // 本幀使用圖層
+        float m_MaxZ = 0.0f;            // 本幀最高的特效 z (圖層合成的位置)
+        std::unique_ptr<Render::ScaledLayer> m_Layer;
+        bool m_StreamBegun = false;
+
+        // 所有形狀共用的四邊形，實例屬性掛在同一個 VAO 上
+        std::unique_ptr<Core::VertexArray> m_VertexArray;
+        // 空心形狀的框與各分段數的環，放在同一組 buffer，以索引範圍區分
+        std::unique_ptr<Core::VertexArray> m_OutlineArray;
+        std::array<MeshRange, static_cast<size_t>(Geometry::COUNT)> m_Meshes{};
+        // 實例資料的串流 ring buffer，每幀寫入其中一段，以偏移指定實例屬性
+        std::unique_ptr<Render::StreamBuffer> m_InstanceStream;
+
+        // 烘焙的外觀：貼圖集在第一次烘焙時建立，烘焙時的單一實例放在獨立的小 buffer
+        static constexpr GLint kAtlasSize = 2048;
+        static constexpr float kMaxBakeSize = 1024.0f;  // 外觀較長的一邊超過時縮小烘焙，繪製時放大
+        static constexpr size_t kMaxBakesPerFrame = 4;
+        std::unique_ptr<Render::TextureAtlas> m_Atlas;
+        std::unique_ptr<Render::ShaderProgram> m_SpriteProgram;
+        std::unique_ptr<Render::UniformTable> m_SpriteUniforms;
+        Render::UniformTable::Id m_SpriteProjection = Render::UniformTable::kInvalid;
+        Render::UniformTable::Id m_SpriteAtlas = Render::UniformTable::kInvalid;
+        GLuint m_BakeBuffer = 0;
+        glm::mat4 m_AtlasProjection = glm::mat4(1.0f);
+        size_t m_BakeCount = 0;
+
+        // 預警遮罩：烘焙好的預警以只輸出覆蓋率的貼圖程式畫進遮罩
+        static constexpr float kTelegraphMaskScale = 0.5f;
+        bool m_TelegraphMaskEnabled = false;
+        bool m_MaskActive = false;      // 本幀使用遮罩
+        std::unique_ptr<Render::CoverageMask> m_Mask;
+        std::unique_ptr<Render::ShaderProgram> m_CoverageProgram;
+        std::unique_ptr<Render::UniformTable> m_CoverageUniforms;
+        Render::UniformTable::Id m_CoverageProjection = Render::UniformTable::kInvalid;
+        Render::UniformTable::Id m_CoverageAtlas = Render::UniformTable::kInvalid;
+        std::vector<EffectInstance> m_MaskInstances;
+        float m_MaskMaxZ = 0.0f;        // 本幀最高的預警 z (遮罩合成的位置)
+        glm::vec4 m_TelegraphFill = glm::vec4(1.0f, 0.1f, 0.1f, 1.0f);
+        glm::vec4 m_TelegraphEdge = glm::vec4(1.0f, 0.3f, 0.2f, 0.8f);
+
+        glm::mat4 m_Projection = glm::mat4(1.0f);
+
+        size_t m_DrawCallCount = 0;
+        size_t m_InstanceCount = 0;
+    };
+
+} // namespace Effect
+
+#endif // EFFECT_BATCH_RENDERER_HPP
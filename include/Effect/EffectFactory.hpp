@@ -21,6 +21,8 @@ namespace Effect {
         // 矩形特效
         RECT_LASER,     // 矩形雷射，實心，邊緣發光，會移動
         RECT_BEAM,      // 矩形光束，空心，邊緣加深，可旋轉
+
+        COUNT           // 類型數量 (對象池以此配置每種類型的空閒列表)
     };
 
     class EffectFactory {
@@ -30,11 +32,12 @@ namespace Effect {
             return instance;
         }
 
-        // 創建預定義特效
-        static std::shared_ptr<CompositeEffect> CreateEffect(EffectType type);
+        // 預定義特效的佔位值：外觀由 Resources/effects.def 中同名的區塊定義，
+        // 這裡只在資料檔缺少時提供形狀類別相同的洋紅色特效 (EffectLibrary 以此建立內建類型的原型)
+        static CompositeEffect CreateEffect(EffectType type);
 
         // 創建自定義組合特效
-        std::shared_ptr<CompositeEffect> CreateCustomEffect(
+        CompositeEffect CreateCustomEffect(
             bool isCircle = true,
             const Modifier::FillType& fillType = Modifier::FillType::SOLID,
             const Modifier::EdgeType& edgeType = Modifier::EdgeType::NONE,
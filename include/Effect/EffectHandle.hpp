@@ -0,0 +1,27 @@
+#ifndef EFFECT_HANDLE_HPP
+#define EFFECT_HANDLE_HPP
+
+#include <cstdint>
+
+namespace Effect {
+
+    // 特效的代號：slot 索引加上世代 (generation)。
+    // 特效回收時世代會加一，所以持有舊代號的人取不到被重新使用的特效。
+    struct EffectHandle {
+        static constexpr uint32_t kInvalidIndex = UINT32_MAX;
+
+        uint32_t index = kInvalidIndex;
+        uint32_t generation = 0;
+
+        bool IsNull() const { return index == kInvalidIndex; }
+        void Clear() { *this = EffectHandle{}; }
+
+        bool operator==(const EffectHandle& other) const {
+            return index == other.index && generation == other.generation;
+        }
+        bool operator!=(const EffectHandle& other) const { return !(*this == other); }
+    };
+
+} // namespace Effect
+
+#endif // EFFECT_HANDLE_HPP
@@ -0,0 +1,30 @@
+#ifndef EFFECT_INSTANCE_HPP
+#define EFFECT_INSTANCE_HPP
+
+#include "pch.hpp"
+
+namespace Effect {
+
+    // 形狀種類，寫入 params.w 並作為著色器變體的 SHAPE_KIND (數值需與 Effect.frag 的 KIND_* 一致)
+    enum class ShapeClass {
+        CIRCLE,
+        ELLIPSE,
+        RECTANGLE,
+        COUNT
+    };
+
+    // 單一特效的實例資料，對應著色器中 location 2 ~ 9 的實例屬性
+    struct EffectInstance {
+        glm::vec4 transform = glm::vec4(0.0f);  // xy: 中心位置(像素), zw: 畫布大小(像素)
+        glm::vec4 params = glm::vec4(0.0f);     // x: 旋轉(弧度), y: z-index, z: 已播放時間, w: 形狀種類
+        glm::vec4 color = glm::vec4(0.0f);      // 基本顏色
+        glm::vec4 shape = glm::vec4(0.0f);      // 圓: x=半徑 / 橢圓: xy=半徑 / 矩形: xy=寬高比例, z=粗細, w=旋轉
+        glm::vec4 fillEdge = glm::vec4(0.0f);   // x: 填充類型, y: 空心粗細, z: 邊緣類型, w: 邊緣寬度
+        glm::vec4 edgeColor = glm::vec4(0.0f);  // 邊緣顏色
+        glm::vec4 animation = glm::vec4(0.0f);  // x: 動畫類型, y: 強度, z: 速度
+        glm::vec4 motion = glm::vec4(0.0f);     // xy: 速度(像素/秒), z: 最大距離, w: 1=移動中 (transform.xy 為起點)
+    };
+
+} // namespace Effect
+
+#endif // EFFECT_INSTANCE_HPP
@@ -0,0 +1,55 @@
+#ifndef EFFECT_LEASE_HPP
+#define EFFECT_LEASE_HPP
+
+#include "Effect/EffectHandle.hpp"
+
+namespace Effect {
+
+    class CompositeEffect;
+
+    // 特效租約：持有一個特效代號，解構或 Release 時把特效還給對象池。
+    // 只能移動不能複製；特效自己播完被回收後，租約會自動變成失效狀態。
+    class EffectLease {
+    public:
+        EffectLease() = default;
+        explicit EffectLease(const EffectHandle& handle) : m_Handle(handle) {}
+        ~EffectLease() { Release(); }
+
+        EffectLease(const EffectLease&) = delete;
+        EffectLease& operator=(const EffectLease&) = delete;
+
+        EffectLease(EffectLease&& other) noexcept : m_Handle(other.m_Handle) { other.m_Handle.Clear(); }
+        EffectLease& operator=(EffectLease&& other) noexcept {
+            if (this != &other) {
+                Release();
+                m_Handle = other.m_Handle;
+                other.m_Handle.Clear();
+            }
+            return *this;
+        }
+
+        // 取得特效；沒有租約或特效已被回收時回傳 nullptr
+        CompositeEffect* Get() const;
+
+        // 立即把特效還給對象池 (特效已被回收時只清除代號)
+        void Release();
+
+        // 放棄所有權，特效播完後由管理器自行回收
+        EffectHandle Detach() {
+            EffectHandle handle = m_Handle;
+            m_Handle.Clear();
+            return handle;
+        }
+
+        const EffectHandle& GetHandle() const { return m_Handle; }
+
+        // 曾經持有特效，但特效已經播完被管理器回收
+        bool IsExpired() const { return !m_Handle.IsNull() && !Get(); }
+
+    private:
+        EffectHandle m_Handle;
+    };
+
+} // namespace Effect
+
+#endif // EFFECT_LEASE_HPP
@@ -0,0 +1,62 @@
+#ifndef EFFECT_LIBRARY_HPP
+#define EFFECT_LIBRARY_HPP
+
+#include <string_view>
+#include "Effect/EffectFactory.hpp"
+
+namespace Effect {
+
+    // 特效原型的編號；內建類型的編號與 EffectType 相同
+    using PrototypeId = uint16_t;
+
+    // 特效原型：一組完整的特效參數 (形狀、顏色、修飾器、持續時間) 與它使用的對象池
+    struct EffectPrototype {
+        std::string name;
+        EffectType poolType;        // 從哪個類型的對象池取用
+        CompositeEffect effect;
+    };
+
+    // 特效原型庫：啟動時從資料檔載入一次，之後只讀。
+    // 取用特效時把原型的參數整組複製到池中的特效 (值型別，不配置記憶體)，
+    // 呼叫端不必每次重新設定修飾器；新的外觀只要改資料檔，不必重新編譯。
+    class EffectLibrary {
+    public:
+        static EffectLibrary& GetInstance() {
+            static EffectLibrary instance;
+            return instance;
+        }
+
+        EffectLibrary(const EffectLibrary&) = delete;
+        EffectLibrary& operator=(const EffectLibrary&) = delete;
+
+        // 載入資料檔 (須在 EffectManager::Initialize 之前)：與內建類型同名的區塊定義該類型的外觀，
+        // 其他區塊新增具名原型。檔案不存在時只有內建類型的佔位特效 (EffectFactory)
+        bool Load(const std::string& path);
+
+        // 以名稱找原型 (啟動後查一次並保存編號)；找不到時警告並回傳 fallback 類型的原型
+        PrototypeId Find(std::string_view name, EffectType fallback) const;
+
+        static PrototypeId GetId(EffectType type) { return static_cast<PrototypeId>(type); }
+
+        const EffectPrototype& Get(PrototypeId id) const {
+            return m_Prototypes[id < m_Prototypes.size() ? id : 0];
+        }
+        const std::vector<EffectPrototype>& GetPrototypes() const { return m_Prototypes; }
+
+    private:
+        EffectLibrary();
+
+        // 內建類型 (依 EffectType 的順序放在最前面)
+        void RegisterBuiltins();
+
+        // 解析區塊內的一行 "欄位 值..."；格式錯誤時回傳 false
+        static bool ParseField(CompositeEffect& effect, const std::string& field, std::istringstream& values);
+
+        size_t IndexOf(std::string_view name) const;
+
+        std::vector<EffectPrototype> m_Prototypes;
+    };
+
+} // namespace Effect
+
+#endif // EFFECT_LIBRARY_HPP
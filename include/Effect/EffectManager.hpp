@@ -1,62 +1,222 @@
 #ifndef EFFECT_MANAGER_HPP
 #define EFFECT_MANAGER_HPP
 
-#include <queue>
+#include <deque>
+#include <optional>
 #include "Effect/CompositeEffect.hpp"
 #include "Effect/EffectFactory.hpp"
-#include "Util/GameObject.hpp"
+#include "Effect/EffectHandle.hpp"
+#include "Effect/EffectLease.hpp"
+#include "Effect/EffectLibrary.hpp"
+#include "Effect/EffectPoolProfile.hpp"
+#include "Effect/EffectBatchRenderer.hpp"
+#include "Effect/ParticleEmitter.hpp"
+#include "Effect/QualityGovernor.hpp"
+#include "Effect/TrailHistory.hpp"
+#include "Render/SceneRenderer.hpp"
 #include "Util/Logger.hpp"
 #include "Util/TransformUtils.hpp"
 
 namespace Effect {
-    class EffectManager : public Util::GameObject {
+    // 特效管理器：對象池、更新，並把特效與粒子送進場景的繪製佇列
+    class EffectManager : public Render::SceneSource, public Render::DrawSource {
     public:
         static EffectManager& GetInstance() {
             static EffectManager instance;
             return instance;
         }
 
-        // 初始化對象池
+        // 初始化對象池；載入過使用紀錄時，紀錄中有的類型改用紀錄的最大使用數量
+        // (特效定義須先以 EffectLibrary::Load 載入)
         void Initialize(size_t initialPoolSize = 10);
 
-        // 獲取或創建特效
-        std::shared_ptr<CompositeEffect> GetEffect(EffectType type);
+        // 讀取對象池使用紀錄 (須在 Initialize 之前)，SavePoolProfile 會寫回同一個檔案
+        void LoadPoolProfile(const std::string& path);
+        void SavePoolProfile() const;
+
+        // 目前的關卡，之後的取用都記在這個關卡底下
+        void SetProfilePhase(int mainPhase, int subPhase) { m_ProfilePhase = {mainPhase, subPhase}; }
+
+        // 初始化後池子不夠用、只好當場建立特效的次數
+        size_t GetPoolMissCount() const { return m_PoolMisses; }
+
+        // 獲取或創建特效，回傳代號；以 Resolve 取得特效本體
+        // 特效的參數一律從原型複製，不會留著上一個使用者的設定
+        // (特效要播完或被 Release 才會回到對象池)
+        EffectHandle GetEffect(PrototypeId prototype);
+        EffectHandle GetEffect(EffectType type) { return GetEffect(EffectLibrary::GetId(type)); }
+
+        // 以租約取得特效，租約解構或 Release 時特效立即回到對象池
+        EffectLease LeaseEffect(PrototypeId prototype) { return EffectLease(GetEffect(prototype)); }
+        EffectLease LeaseEffect(EffectType type) { return EffectLease(GetEffect(type)); }
+
+        // 把特效還給對象池；代號已失效時不做任何事並回傳 false
+        bool Release(const EffectHandle& handle);
+
+        // 取得代號對應的特效；特效已回收 (代號過期) 時回傳 nullptr
+        // (指標只在當下使用，長期保存請保存代號)
+        CompositeEffect* Resolve(const EffectHandle& handle);
+        const CompositeEffect* Resolve(const EffectHandle& handle) const;
+
+        // 代號是否仍指向使用中的特效
+        bool IsAlive(const EffectHandle& handle) const { return Resolve(handle) != nullptr; }
 
         // 更新所有特效
         void Update(float deltaTime);
 
-        // 繪製所有特效
-        void Draw() override;
+        // 把所有播放中的特效與粒子發射器送進繪製佇列 (依各自的 z-index 與場景物件穿插)
+        void Submit(Render::DrawQueue& queue) override;
+
+        // 粒子發射器的繪製 (payload 為發射器索引)
+        void DrawRun(const uint32_t* payloads, size_t count) override;
+        void EndFrame() override;
 
         // 直接播放特效
-        std::shared_ptr<CompositeEffect> PlayEffect(
+        EffectHandle PlayEffect(
             EffectType type,
             const glm::vec2& position,
             float zIndex = 0.0f,
             float duration = 1.0f
         );
 
+        // 批次生成的一個特效：沒有設定的欄位沿用原型
+        struct Spawn {
+            PrototypeId prototype = 0;
+            glm::vec2 position = glm::vec2(0.0f);
+            float zIndex = 0.0f;
+            std::optional<float> rotation;              // 矩形的角度 (弧度)
+            std::optional<glm::vec2> dimensions;        // 矩形的寬高比例
+            std::optional<glm::vec2> size;              // 畫布大小 (像素)
+            std::optional<Util::Color> color;
+            std::optional<float> duration;
+        };
+
+        // 一次生成並播放 count 個特效 (彈幕、整組預警)，代號依序寫入 handles。
+        // 各對象池先一次補足數量，之後只從空閒列表尾端取用、複製原型參數；
+        // 池子夠用且使用中列表容量足夠時不配置記憶體
+        void PlayEffects(const Spawn* spawns, size_t count, EffectHandle* handles);
+
         // 取得活躍特效數量
-        size_t GetActiveEffectsCount() const { return m_ActiveEffects.size(); }
-        void ClearAllEffects() {
-            // 重置所有活躍特效
-            for (auto& effect : m_ActiveEffects) {
-                if (effect) {
-                    effect->Reset();
-                }
-            }
-            m_ActiveEffects.clear();
+        size_t GetActiveEffectsCount() const { return m_Active.size(); }
+
+        // 建立粒子發射器，由管理器持有並更新、繪製
+        // (指標在 DestroyEmitter 或閒置後自動移除之前有效)
+        ParticleEmitter* CreateEmitter(const ParticleEmitter::Settings& settings,
+                                       const glm::vec2& position, float zIndex = 40.0f);
+        void DestroyEmitter(const ParticleEmitter* emitter);
+
+        // 所有發射器存活的粒子數
+        size_t GetParticleCount() const;
+
+        // 重置所有使用中的特效並放回對象池，並移除所有粒子發射器
+        void ClearAllEffects();
+
+        // 列出被取走卻沒有播放的特效 (從沒播放過、或被手動 Reset 而沒有還回來，各類型的累計次數)
+        void LogLeakReport() const;
+
+        // 品質等級 (通常由 QualityGovernor 設定)：依等級關閉發光與尾跡 / 波紋動畫
+        void SetQualityTier(QualityTier tier);
+        QualityTier GetQualityTier() const { return m_QualityTier; }
+
+        // 剔除：繪製前略過包圍圓完全在畫面矩形外的特效 (中心為原點的像素坐標，預設為 1280x720 的視窗)
+        void SetViewRect(const glm::vec2& min, const glm::vec2& max) {
+            m_ViewMin = min;
+            m_ViewMax = max;
         }
+        // 自動回收：移動的特效整個離開場地 (畫面矩形向外擴大 margin 像素) 後，若已停下或仍在遠離就提早結束，
+        // 不必等移動距離或持續時間用完 (持有代號的一方會看到代號失效)
+        void SetAutoRetire(bool enabled, float margin = kDefaultRetireMargin) {
+            m_AutoRetire = enabled;
+            m_RetireMargin = margin;
+        }
+        bool IsAutoRetireEnabled() const { return m_AutoRetire; }
+
+        // 上一次 Submit 剔除、上一次 Update 自動回收的特效數
+        size_t GetCulledCount() const { return m_CulledCount; }
+        size_t GetRetiredCount() const { return m_RetiredCount; }
+
+        // 管理器已經解構 (程式結束中)
+        static bool IsShutDown() { return s_ShutDown; }
 
     private:
-        EffectManager() : Util::GameObject(nullptr, 30.0f) {}
+        EffectManager() = default;
+        ~EffectManager() override { s_ShutDown = true; }
+
+        // 取走後一直沒有播放 (或被手動 Reset) 超過這個時間的特效記為洩漏並警告 (不收回，仍由持有者歸還)
+        static constexpr float kIdleReportTime = 1.0f;
+        // 自動回收的場地比畫面向外多出的距離 (像素)
+        static constexpr float kDefaultRetireMargin = 200.0f;
+
+        // 特效直接以值存放；deque 在尾端加入時不會搬動既有元素，
+        // 所以 Resolve 取得的指標在池擴充後仍然有效
+        struct Slot {
+            CompositeEffect effect;
+            EffectType type;
+            uint32_t generation = 0;    // 每次回收加一，讓舊代號失效
+            uint32_t activeIndex = 0;   // 在 m_Active 中的位置 (使用中才有意義)
+            float idleTime = 0.0f;      // 使用中但沒有在播放的時間
+            bool wasPlayed = false;     // 這次取用後是否播放過
+            bool idleReported = false;  // 這次取用已經記過洩漏
+            TrailHistory trail{};       // 有尾跡的特效走過的位置
+            bool inUse = false;
+        };
+
+        uint32_t CreateSlot(EffectType type);
+        void ReleaseSlot(uint32_t index);
+
+        // 確保類型的空閒列表至少有 count 個 (不夠時當場建立)，回傳初始化後當場建立的數量
+        uint32_t EnsureFree(EffectType type, size_t count);
+        // 取出空閒列表尾端的 slot 並標記為使用中 (須先 EnsureFree)
+        uint32_t ClaimFree(EffectType type);
+
+        // 依目前品質等級調整特效的著色器變體 (修飾器本身不變，恢復等級時原樣繪製)
+        ShaderVariant ApplyQuality(ShaderVariant variant) const;
+        // 移動的特效已離開場地，且已停下或仍在遠離
+        bool ShouldRetire(const CompositeEffect& effect) const;
+
+        // 靜止的特效改畫烘焙的外觀，預警範圍再併入預警遮罩
+        static EffectBatchRenderer::DrawPath SelectDrawPath(const CompositeEffect& effect);
+
+        std::deque<Slot> m_Slots;
+
+        // 使用中的 slot 索引，緊密排列；回收時與最後一個交換後移除 (O(1))
+        std::vector<uint32_t> m_Active;
+
+        // 粒子發射器 (數量少，各自持有大量粒子)
+        std::vector<std::unique_ptr<ParticleEmitter>> m_Emitters;
+
+        // 對象池：按類型分類的空閒 slot
+        std::array<std::vector<uint32_t>, static_cast<size_t>(EffectType::COUNT)> m_FreeSlots;
+
+        // 使用紀錄：各類型目前的使用數量、本次執行的紀錄與啟動時載入的紀錄
+        std::array<uint32_t, static_cast<size_t>(EffectType::COUNT)> m_InUseByType{};
+        EffectPoolProfile m_Profile;
+        EffectPoolProfile m_LoadedProfile;
+        std::string m_ProfilePath;
+        EffectPoolProfile::PhaseKey m_ProfilePhase = {0, 0};
+        size_t m_PoolMisses = 0;
+        bool m_Initialized = false;
+
+        QualityTier m_QualityTier = QualityTier::FULL;
+
+        // 剔除與自動回收
+        glm::vec2 m_ViewMin = glm::vec2(-640.0f, -360.0f);
+        glm::vec2 m_ViewMax = glm::vec2(640.0f, 360.0f);
+        bool m_AutoRetire = false;
+        float m_RetireMargin = kDefaultRetireMargin;
+        size_t m_CulledCount = 0;
+        size_t m_RetiredCount = 0;
 
-        // 特效對象池，按類型分類
-        std::unordered_map<EffectType, std::queue<std::shared_ptr<CompositeEffect>>> m_InactiveEffects;
+        // 洩漏紀錄：取走後沒播放、手動 Reset 後沒有還回來
+        // (特效在 Update 中播完就標記為結束並回收，不會有超過持續時間還在播的情況)
+        struct LeakCounts {
+            uint32_t neverPlayed = 0;
+            uint32_t abandoned = 0;
+        };
+        std::array<LeakCounts, static_cast<size_t>(EffectType::COUNT)> m_Leaks{};
 
-        // 當前活躍的特效
-        std::vector<std::shared_ptr<CompositeEffect>> m_ActiveEffects;
+        static inline bool s_ShutDown = false;
     };
 }
 
-#endif // EFFECT_MANAGER_HPP
\ No newline at end of file
+#endif // EFFECT_MANAGER_HPP
@@ -0,0 +1,49 @@
+#ifndef EFFECT_POOL_PROFILE_HPP
+#define EFFECT_POOL_PROFILE_HPP
+
+#include <map>
+#include "Effect/EffectFactory.hpp"
+
+namespace Effect {
+
+    // 對象池使用紀錄：每個關卡 (大關-小關) 每種特效同時使用的最大數量 (high-water)
+    // 與池子不夠用、只好當場建立的次數 (miss)。
+    // 存成文字檔，下次啟動時以各類型的最大值預先配置對象池。
+    class EffectPoolProfile {
+    public:
+        static constexpr size_t kTypeCount = static_cast<size_t>(EffectType::COUNT);
+
+        struct Entry {
+            uint32_t highWater = 0;
+            uint32_t misses = 0;
+        };
+
+        using PhaseKey = std::pair<int, int>;           // (大關, 小關)
+        using Row = std::array<Entry, kTypeCount>;
+
+        // 紀錄一次取用：inUse 為取用後該類型的使用數量，misses 為這次當場建立的數量
+        void RecordAcquire(const PhaseKey& phase, EffectType type, uint32_t inUse, uint32_t misses);
+
+        // 合併新的紀錄：最大使用數取較大值，不夠用的次數改為新紀錄的值
+        void Merge(const EffectPoolProfile& other);
+
+        // 所有關卡中該類型的最大使用數量 (沒有紀錄時回傳 0)
+        uint32_t GetHighWater(EffectType type) const;
+        uint32_t GetTotalMisses() const;
+
+        bool HasType(EffectType type) const;
+        bool IsEmpty() const { return m_Rows.empty(); }
+
+        // 檔案格式：每行 "大關-小關 類型名稱 high-water miss"，# 開頭為註解
+        bool Load(const std::string& path);
+        bool Save(const std::string& path) const;
+
+        static const char* GetTypeName(EffectType type);
+
+    private:
+        std::map<PhaseKey, Row> m_Rows;
+    };
+
+} // namespace Effect
+
+#endif // EFFECT_POOL_PROFILE_HPP
@@ -1,7 +1,7 @@
 #ifndef ANIMATIONMODIFIER_HPP
 #define ANIMATIONMODIFIER_HPP
 
-#include "Effect/Shape/BaseShape.hpp"
+#include "Effect/EffectInstance.hpp"
 
 namespace Effect {
     namespace Modifier {
@@ -17,8 +17,8 @@ namespace Effect {
         public:
             AnimationModifier(AnimationType type = AnimationType::NONE, float intensity = 1.0f, float speed = 1.0f);
 
-            // 應用動畫效果
-            void Apply(Core::Program& program, float time);
+            // 寫入批次繪製的實例資料 (時間由特效本身提供)
+            void Apply(EffectInstance& instance) const;
 
             // 設置參數
             void SetAnimationType(AnimationType type) { m_AnimationType = type; }
@@ -34,10 +34,6 @@ namespace Effect {
             AnimationType m_AnimationType;
             float m_Intensity;        // 效果強度
             float m_Speed;            // 效果速度
-
-            GLint m_AnimTypeLocation = -1;
-            GLint m_IntensityLocation = -1;
-            GLint m_SpeedLocation = -1;
         };
 
     } // namespace Modifier
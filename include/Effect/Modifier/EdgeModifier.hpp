@@ -1,7 +1,8 @@
 #ifndef EDGEMODIFIER_HPP
 #define EDGEMODIFIER_HPP
 
-#include "Effect/Shape/BaseShape.hpp"
+#include "Effect/EffectInstance.hpp"
+#include "Util/Color.hpp"
 
 namespace Effect {
     namespace Modifier {
@@ -17,8 +18,8 @@ namespace Effect {
         public:
             EdgeModifier(EdgeType type = EdgeType::NONE, float width = 0.05f, const Util::Color& edgeColor = Util::Color::FromName(Util::Colors::PINK));
 
-            // 應用邊緣效果
-            void Apply(Core::Program& program);
+            // 寫入批次繪製的實例資料
+            void Apply(EffectInstance& instance) const;
 
             // 設置參數
             void SetEdgeType(EdgeType type) { m_EdgeType = type; }
@@ -34,10 +35,6 @@ namespace Effect {
             EdgeType m_EdgeType;
             float m_Width;           // 邊緣寬度
             Util::Color m_EdgeColor; // 邊緣顏色
-
-            GLint m_EdgeTypeLocation = -1;
-            GLint m_EdgeWidthLocation = -1;
-            GLint m_EdgeColorLocation = -1;
         };
 
     } // namespace Modifier
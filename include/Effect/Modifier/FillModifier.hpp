@@ -1,7 +1,7 @@
 #ifndef FILLMODIFIER_HPP
 #define FILLMODIFIER_HPP
 
-#include "Effect/Shape/BaseShape.hpp"
+#include "Effect/EffectInstance.hpp"
 
 namespace Effect {
     namespace Modifier {
@@ -16,8 +16,8 @@ namespace Effect {
         public:
             FillModifier(FillType type = FillType::SOLID, float thickness = 0.02f);
 
-            // 應用填充效果
-            void Apply(Core::Program& program);
+            // 寫入批次繪製的實例資料
+            void Apply(EffectInstance& instance) const;
 
             // 設置參數
             void SetFillType(FillType type) { m_FillType = type; }
@@ -29,9 +29,6 @@ namespace Effect {
         private:
             FillType m_FillType;
             float m_Thickness;   // 空心時的線條粗細
-
-            GLint m_FillTypeLocation = -1;
-            GLint m_ThicknessLocation = -1;
         };
 
     } // namespace Modifier
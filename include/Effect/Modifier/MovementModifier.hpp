@@ -1,17 +1,28 @@
 #ifndef MOVEMENTMODIFIER_HPP
 #define MOVEMENTMODIFIER_HPP
 
-#include "pch.hpp"
+#include "Effect/EffectInstance.hpp"
 
 namespace Effect {
     namespace Modifier {
 
+        // 直線移動：起點、方向、速度與最大距離都在播放時決定，
+        // 之後的位置是播放時間的封閉解，由頂點著色器計算，CPU 只在需要時 (碰撞) 才算
         class MovementModifier {
         public:
             MovementModifier(bool isMoving = false, float speed = 200.0f, float distance = 400.0f, const glm::vec2& direction = {1.0f, 0.0f});
 
-            // 更新位置
-            void Update(float deltaTime, glm::vec2& position);
+            // 開始移動：記錄起點，directionScale 乘在速度上 (例如 -1 代表反向)
+            void Start(const glm::vec2& startPosition, float directionScale = 1.0f);
+
+            // 播放 elapsed 秒後的位置 (超過最大距離就停在終點)
+            glm::vec2 Evaluate(float elapsed) const;
+
+            // 播放 elapsed 秒後是否已達到最大距離
+            bool HasReachedDestination(float elapsed) const;
+
+            // 寫入批次繪製的實例資料 (位置由著色器依播放時間計算)
+            void Apply(EffectInstance& instance) const;
 
             // 設置參數
             void SetMoving(bool isMoving) { m_IsMoving = isMoving; }
@@ -27,11 +38,9 @@ namespace Effect {
             const glm::vec2& GetDirection() const { return m_Direction; }
 
             void SetStartPosition(const glm::vec2& position) { m_StartPosition = position; }
-            // 重置移動狀態
-            void Reset();
 
-            // 檢查是否已達到最大距離
-            bool HasReachedDestination() const;
+            // 實際的速度向量 (像素/秒)
+            glm::vec2 GetVelocity() const { return m_Direction * (m_Speed * m_DirectionScale); }
 
         private:
             bool m_IsMoving;                // 是否移動
@@ -39,8 +48,8 @@ namespace Effect {
             float m_MaxDistance;            // 最大移動距離
             glm::vec2 m_Direction;          // 移動方向
 
-            glm::vec2 m_StartPosition;      // 起始位置
-            float m_DistanceTraveled = 0.0f; // 已移動距離
+            glm::vec2 m_StartPosition = glm::vec2(0.0f);  // 起始位置
+            float m_DirectionScale = 1.0f;                // 本次播放的方向倍率
         };
 
     } // namespace Modifier
@@ -0,0 +1,109 @@
+#ifndef EFFECT_PARTICLE_EMITTER_HPP
+#define EFFECT_PARTICLE_EMITTER_HPP
+
+#include <random>
+#include "pch.hpp"
+#include "Render/ShaderProgram.hpp"
+#include "Core/VertexArray.hpp"
+#include "Render/UniformTable.hpp"
+#include "Render/StreamBuffer.hpp"
+#include "Util/Color.hpp"
+
+namespace Effect {
+
+    // 單一粒子的實例資料，對應 Particle.vert 中 location 2 ~ 3 的實例屬性
+    struct ParticleInstance {
+        glm::vec4 positionSize = glm::vec4(0.0f);   // xy: 位置(像素), z: 大小(像素), w: z-index
+        glm::vec4 color = glm::vec4(0.0f);
+    };
+
+    // 粒子發射器：火花、尾跡、碎片這類大量小點。
+    // 粒子以 structure-of-arrays 存放 (沒有每顆粒子的物件)，更新是可向量化的連續迴圈，
+    // 一個發射器的所有粒子用一次 instanced draw 畫完。由 EffectManager 持有與更新。
+    class ParticleEmitter {
+    public:
+        struct Settings {
+            size_t maxParticles = 1024;
+            float emissionRate = 0.0f;              // 每秒持續發射的數量 (0 = 只用 Burst)
+            float lifetimeMin = 0.3f;               // 秒
+            float lifetimeMax = 0.6f;
+            float speedMin = 100.0f;                // 像素/秒
+            float speedMax = 300.0f;
+            glm::vec2 direction = {0.0f, 1.0f};     // 發射方向
+            float spread = 3.14159265f;             // 方向兩側的散布角度 (弧度)，pi 為全方向
+            glm::vec2 gravity = {0.0f, 0.0f};       // 像素/秒^2
+            float drag = 0.0f;                      // 每秒速度衰減比例
+            float sizeStart = 8.0f;                 // 像素
+            float sizeEnd = 2.0f;
+            Util::Color colorStart = Util::Color(1.0f, 0.9f, 0.5f, 1.0f);
+            Util::Color colorEnd = Util::Color(1.0f, 0.2f, 0.0f, 0.0f);
+        };
+
+        explicit ParticleEmitter(const Settings& settings, float zIndex = 40.0f);
+
+        // 一次發射 count 顆粒子 (超過上限的部分捨棄)
+        void Burst(size_t count);
+
+        // 持續發射的開關 (依 emissionRate)
+        void SetEmitting(bool emitting) { m_Emitting = emitting; }
+        bool IsEmitting() const { return m_Emitting; }
+
+        void SetPosition(const glm::vec2& position) { m_Position = position; }
+        const glm::vec2& GetPosition() const { return m_Position; }
+        void SetZIndex(float zIndex) { m_ZIndex = zIndex; }
+        float GetZIndex() const { return m_ZIndex; }
+
+        Settings& GetSettings() { return m_Settings; }
+        const Settings& GetSettings() const { return m_Settings; }
+
+        // 不再發射且沒有存活的粒子時，管理器會自動移除 (SetAutoRemove)
+        void SetAutoRemove(bool autoRemove) { m_AutoRemove = autoRemove; }
+        bool IsAutoRemove() const { return m_AutoRemove; }
+        bool IsIdle() const { return !m_Emitting && m_Count == 0; }
+
+        size_t GetParticleCount() const { return m_Count; }
+
+        void Update(float deltaTime);
+
+        // 整批繪製：BeginBatch 先保留本幀所有發射器的粒子容量，再依繪製佇列的順序逐一 Draw，最後 EndBatch
+        static void BeginBatch(size_t totalParticles);
+        void Draw() const;
+        static void EndBatch();
+
+    private:
+        void Spawn(size_t count);
+        void WriteInstances() const;
+
+        static void InitializeResources();
+
+        Settings m_Settings;
+        glm::vec2 m_Position = glm::vec2(0.0f);
+        float m_ZIndex;
+        bool m_Emitting = false;
+        bool m_AutoRemove = false;
+        float m_EmitAccumulator = 0.0f;
+
+        // 粒子資料 (SoA)，只有前 m_Count 個是存活的
+        size_t m_Count = 0;
+        std::vector<float> m_PositionX;
+        std::vector<float> m_PositionY;
+        std::vector<float> m_VelocityX;
+        std::vector<float> m_VelocityY;
+        std::vector<float> m_Age;
+        std::vector<float> m_Lifetime;
+
+        std::mt19937 m_Random;
+
+        // 所有發射器共用的繪製資源
+        static std::unique_ptr<Render::ShaderProgram> s_Program;
+        static std::unique_ptr<Render::UniformTable> s_Uniforms;
+        static Render::UniformTable::Id s_ProjectionUniform;
+        static std::unique_ptr<Core::VertexArray> s_VertexArray;
+        static std::unique_ptr<Render::StreamBuffer> s_InstanceStream;
+        static std::vector<ParticleInstance> s_Instances;   // 寫入用的暫存
+        static glm::mat4 s_Projection;
+    };
+
+} // namespace Effect
+
+#endif // EFFECT_PARTICLE_EMITTER_HPP
@@ -0,0 +1,98 @@
+#ifndef EFFECT_QUALITY_GOVERNOR_HPP
+#define EFFECT_QUALITY_GOVERNOR_HPP
+
+#include <deque>
+#include "pch.hpp"
+
+namespace Effect {
+
+    // 特效品質等級，數字越大越省；每一級都包含前面各級的省略
+    enum class QualityTier {
+        FULL,               // 完整：發光邊緣 (bloom)、尾跡與波紋動畫
+        NO_GLOW,            // 關閉發光：邊緣只混入顏色，不做 bloom
+        NO_ANIMATION,       // 關閉尾跡與波紋動畫
+        REDUCED_RESOLUTION, // 降低特效的繪製解析度
+        COUNT
+    };
+
+    // 特效品質調節器：觀察最近一段時間的幀時間，太慢就降一級、回到目標而且穩定一段時間才升一級。
+    // 框架限制了幀率 (PTSD 的 FPS_CAP)，幀時間不會低於目標，所以升級看的是「平均貼近目標」的持續時間，
+    // 而不是比目標快多少。降級與升級使用不同的門檻 (hysteresis)，避免在兩級之間來回跳；
+    // 升上去不久又降下來的等級記為失敗，每失敗一次升回該級的等待時間加倍，失敗太多次就不再升回。
+    // 等級透過 EffectManager::SetQualityTier 套用。
+    class QualityGovernor {
+    public:
+        struct Switch {
+            float time = 0.0f;          // 距離開始計時的秒數
+            QualityTier from = QualityTier::FULL;
+            QualityTier to = QualityTier::FULL;
+            float averageMs = 0.0f;     // 觸發切換時的平均幀時間
+        };
+
+        static QualityGovernor& GetInstance() {
+            static QualityGovernor instance;
+            return instance;
+        }
+
+        QualityGovernor(const QualityGovernor&) = delete;
+        QualityGovernor& operator=(const QualityGovernor&) = delete;
+
+        // 每幀呼叫一次，傳入這一幀的時間 (秒)
+        void Update(float deltaTime);
+
+        // 目標幀時間 (預設 1/60 秒，與框架的幀率上限相同)
+        void SetTargetFrameTime(float seconds) { m_TargetFrameTime = seconds; }
+        float GetTargetFrameTime() const { return m_TargetFrameTime; }
+
+        // 關閉時回到 FULL 並停止調整
+        void SetEnabled(bool enabled);
+        bool IsEnabled() const { return m_Enabled; }
+
+        // 手動指定等級 (會記錄在切換紀錄中)
+        void ForceTier(QualityTier tier);
+
+        QualityTier GetTier() const { return m_Tier; }
+        // 升回某一級需要連續跟得上的時間 (秒)；該級失敗太多次時回傳負數，表示不再升回
+        float GetUpgradeDelay(QualityTier tier) const;
+        float GetAverageFrameTimeMs() const;
+        const std::deque<Switch>& GetHistory() const { return m_History; }
+
+        static const char* GetTierName(QualityTier tier);
+
+    private:
+        QualityGovernor() = default;
+
+        void SwitchTo(QualityTier tier);
+
+        static constexpr size_t kWindowSize = 90;           // 約 1.5 秒 (60 FPS)
+        static constexpr float kDowngradeRatio = 1.2f;      // 平均超過目標 20% 就降級
+        static constexpr float kSteadyRatio = 1.1f;         // 平均在目標 10% 以內算是跟得上
+        static constexpr float kUpgradeDelay = 5.0f;        // 連續跟得上這麼久才升一級 (秒)，每次失敗加倍
+        static constexpr float kFailureWindow = 30.0f;      // 升級後這段時間內又降級，算該級失敗 (秒)
+        static constexpr uint8_t kMaxFailures = 4;          // 失敗這麼多次就不再升回該級
+        // 幀率上限下的穩定狀態 (平均剛好等於目標) 必須算跟得上，否則降級後永遠升不回來
+        static_assert(kSteadyRatio > 1.0f && kSteadyRatio < kDowngradeRatio,
+                      "a frame-capped steady state must count as steady without triggering a downgrade");
+        static constexpr float kHitchThreshold = 0.25f;     // 超過的幀視為讀取造成的卡頓，不列入 (秒)
+        static constexpr size_t kMaxHistory = 64;
+
+        std::array<float, kWindowSize> m_Window{};
+        size_t m_WindowCount = 0;   // 視窗內的有效幀數
+        size_t m_WindowNext = 0;
+        float m_WindowSum = 0.0f;
+
+        float m_TargetFrameTime = 1.0f / 60.0f;
+        float m_Clock = 0.0f;           // 開始計時後經過的時間
+        float m_SteadyTime = 0.0f;      // 平均連續貼近目標的時間
+        float m_TierStart = 0.0f;       // 進入目前等級的時間
+        bool m_Upgraded = false;        // 目前等級是由升級進入的
+        std::array<uint8_t, static_cast<size_t>(QualityTier::COUNT)> m_Failures{};  // 各等級升上去後撐不住的次數
+        bool m_Enabled = true;
+
+        QualityTier m_Tier = QualityTier::FULL;
+        std::deque<Switch> m_History;
+    };
+
+} // namespace Effect
+
+#endif // EFFECT_QUALITY_GOVERNOR_HPP
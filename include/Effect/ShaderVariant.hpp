@@ -0,0 +1,79 @@
+#ifndef EFFECT_SHADER_VARIANT_HPP
+#define EFFECT_SHADER_VARIANT_HPP
+
+#include "Effect/EffectInstance.hpp"
+#include "Effect/Modifier/FillModifier.hpp"
+#include "Effect/Modifier/EdgeModifier.hpp"
+#include "Effect/Modifier/AnimationModifier.hpp"
+
+namespace Effect {
+
+    // 發光邊緣的畫法 (只對 EdgeType::GLOW 有意義，其他邊緣一律用 DIRECT)
+    enum class GlowPass {
+        DIRECT,     // 在特效著色器內直接提高邊緣亮度
+        BLOOM_BASE, // 開啟 bloom 時的主繪製：只混入邊緣顏色，不提高亮度
+        EMISSIVE,   // 開啟 bloom 時輸出到發光貼圖：只有發光量
+        COUNT
+    };
+
+    // 特效著色器的編譯期變體：形狀與填充 / 邊緣 / 動畫類型在編譯時以 #define 寫死，
+    // 片段著色器只留下這個組合用得到的程式碼，不再依實例屬性分支
+    struct ShaderVariant {
+        // 各列舉的數量 (列舉新增類型時需一併修改)
+        static constexpr uint16_t kShapeCount = static_cast<uint16_t>(ShapeClass::COUNT);
+        static constexpr uint16_t kFillCount = 2;
+        static constexpr uint16_t kEdgeCount = 3;
+        static constexpr uint16_t kAnimationCount = 3;
+        static constexpr uint16_t kPassCount = static_cast<uint16_t>(GlowPass::COUNT);
+        static constexpr uint16_t kCount = kShapeCount * kFillCount * kEdgeCount * kAnimationCount * kPassCount;
+
+        ShapeClass shape = ShapeClass::CIRCLE;
+        Modifier::FillType fill = Modifier::FillType::SOLID;
+        Modifier::EdgeType edge = Modifier::EdgeType::NONE;
+        Modifier::AnimationType animation = Modifier::AnimationType::NONE;
+        GlowPass glow = GlowPass::DIRECT;
+
+        // 換成另一種發光畫法 (沒有發光邊緣的特效維持 DIRECT，不多編譯重複的程式)
+        ShaderVariant WithGlowPass(GlowPass pass) const {
+            ShaderVariant variant = *this;
+            variant.glow = edge == Modifier::EdgeType::GLOW ? pass : GlowPass::DIRECT;
+            return variant;
+        }
+
+        // 0 ~ kCount-1 的編號，用於排序鍵與程式快取
+        uint16_t GetKey() const {
+            uint16_t key = static_cast<uint16_t>(glow);
+            key = key * kShapeCount + static_cast<uint16_t>(shape);
+            key = key * kFillCount + static_cast<uint16_t>(fill);
+            key = key * kEdgeCount + static_cast<uint16_t>(edge);
+            key = key * kAnimationCount + static_cast<uint16_t>(animation);
+            return key;
+        }
+
+        static ShaderVariant FromKey(uint16_t key) {
+            ShaderVariant variant;
+            variant.animation = static_cast<Modifier::AnimationType>(key % kAnimationCount);
+            key /= kAnimationCount;
+            variant.edge = static_cast<Modifier::EdgeType>(key % kEdgeCount);
+            key /= kEdgeCount;
+            variant.fill = static_cast<Modifier::FillType>(key % kFillCount);
+            key /= kFillCount;
+            variant.shape = static_cast<ShapeClass>(key % kShapeCount);
+            key /= kShapeCount;
+            variant.glow = static_cast<GlowPass>(key);
+            return variant;
+        }
+
+        // 接在 #version 之後的定義 (數值需與 Effect.vert / Effect.frag 的常數一致)
+        std::string GetDefines() const {
+            return "#define SHAPE_KIND " + std::to_string(static_cast<int>(shape)) + "\n" +
+                   "#define FILL_TYPE " + std::to_string(static_cast<int>(fill)) + "\n" +
+                   "#define EDGE_TYPE " + std::to_string(static_cast<int>(edge)) + "\n" +
+                   "#define ANIM_TYPE " + std::to_string(static_cast<int>(animation)) + "\n" +
+                   "#define GLOW_PASS " + std::to_string(static_cast<int>(glow)) + "\n";
+        }
+    };
+
+} // namespace Effect
+
+#endif // EFFECT_SHADER_VARIANT_HPP
@@ -1,40 +1,27 @@
 #ifndef CIRCLESHAPE_HPP
 #define CIRCLESHAPE_HPP
-#include "BaseShape.hpp"
+
+#include "Effect/EffectInstance.hpp"
 
 namespace Effect {
     namespace Shape {
 
-        class CircleShape : public BaseShape {
+        // 圓形：只保存幾何參數，由 CompositeEffect 以值的方式持有
+        class CircleShape {
         public:
-            CircleShape(float radius = 0.4f, float duration = 1.0f);
-            ~CircleShape() override;
+            explicit CircleShape(float radius = 0.4f, const glm::vec2& size = {400, 400});
 
-            // 實現自Core::Drawable
-            void Draw(const Core::Matrices& data) override;
-            glm::vec2 GetSize() const override { return m_Size; }
+            // 寫入批次繪製的實例資料
+            void WriteInstance(EffectInstance& instance) const;
 
             // 設置圓形屬性
             void SetRadius(float radius) { m_Radius = radius; }
             float GetRadius() const { return m_Radius; }
 
             void SetSize(const glm::vec2& size) { m_Size = size; }
+            glm::vec2 GetSize() const { return m_Size; }
 
-            static Core::Program* GetProgram() { return s_Program.get(); }
-            static Core::VertexArray* GetVertexArray() { return s_VertexArray.get(); }
-
-        protected:
-            void InitializeResources() override;
-
-            static std::unique_ptr<Core::Program> s_Program;
-            static std::unique_ptr<Core::VertexArray> s_VertexArray;
-
-            std::unique_ptr<Core::UniformBuffer<Core::Matrices>> m_MatricesBuffer;
-
-            GLint m_RadiusLocation = -1;
-            GLint m_ColorLocation = -1;
-            GLint m_TimeLocation = -1;
-
+        private:
             float m_Radius = 0.4f;           // 圓的半徑
             glm::vec2 m_Size = {400, 400};   // 效果的大小
         };
@@ -1,25 +1,26 @@
 #ifndef RECTANGLESHAPE_HPP
 #define RECTANGLESHAPE_HPP
 
-#include "BaseShape.hpp"
-#include "config.hpp"
+#include "Effect/EffectInstance.hpp"
 
 namespace Effect {
     namespace Shape {
 
-        class RectangleShape : public BaseShape {
+        // 矩形：保存幾何參數與自動旋轉狀態，由 CompositeEffect 以值的方式持有
+        class RectangleShape {
         public:
-            RectangleShape(const glm::vec2& dimensions = {0.8f, 0.1f},
+            explicit RectangleShape(const glm::vec2& dimensions = {0.8f, 0.1f},
                         float thickness = 0.03f,
                         float rotation = 0.0f,
-                        float duration = 1.0f,
                         bool autoRotate = false,
-                        float rotationSpeed = 2.0f);
-            ~RectangleShape() override;
+                        float rotationSpeed = 2.0f,
+                        const glm::vec2& size = {400, 400});
 
-            // 實現自Core::Drawable
-            void Draw(const Core::Matrices& data) override;
-            glm::vec2 GetSize() const override { return m_Size; }
+            // 自動旋轉 (由 CompositeEffect 在播放中呼叫)
+            void Update(float deltaTime);
+
+            // 寫入批次繪製的實例資料
+            void WriteInstance(EffectInstance& instance) const;
 
             // 旋轉設置
             void SetAutoRotation(bool enable, float speed = 2.0f) {
@@ -29,9 +30,6 @@ namespace Effect {
             bool IsAutoRotating() const { return m_AutoRotate; }
             float GetRotationSpeed() const { return m_RotationSpeed; }
 
-            // 實現自Effect::IEffect
-            void Update(float deltaTime) override;
-
             // 設置矩形屬性
             void SetDimensions(const glm::vec2& dimensions) { m_Dimensions = dimensions; }
             const glm::vec2& GetDimensions() const { return m_Dimensions; }
@@ -43,24 +41,9 @@ namespace Effect {
             float GetRotation() const { return m_Rotation; }
 
             void SetSize(const glm::vec2& size) { m_Size = size; }
+            glm::vec2 GetSize() const { return m_Size; }
 
-            static Core::Program* GetProgram() { return s_Program.get(); }
-            static Core::VertexArray* GetVertexArray() { return s_VertexArray.get(); }
-
-        protected:
-            void InitializeResources() override;
-
-            static std::unique_ptr<Core::Program> s_Program;
-            static std::unique_ptr<Core::VertexArray> s_VertexArray;
-
-            std::unique_ptr<Core::UniformBuffer<Core::Matrices>> m_MatricesBuffer;
-
-            GLint m_DimensionsLocation = -1;
-            GLint m_ThicknessLocation = -1;
-            GLint m_RotationLocation = -1;
-            GLint m_ColorLocation = -1;
-            GLint m_TimeLocation = -1;
-
+        private:
             glm::vec2 m_Dimensions = {0.8f, 0.1f}; // 矩形的寬高比例
             float m_Thickness = 0.03f;             // 矩形的粗細 (實心為0或負值)
             float m_Rotation = 0.0f;               // 矩形的旋轉角度 (弧度)
@@ -74,4 +57,4 @@ namespace Effect {
     } // namespace Shape
 } // namespace Effect
 
-#endif //RECTANGLESHAPE_HPP
\ No newline at end of file
+#endif //RECTANGLESHAPE_HPP
@@ -0,0 +1,46 @@
+#ifndef EFFECT_TRAIL_HISTORY_HPP
+#define EFFECT_TRAIL_HISTORY_HPP
+
+#include "pch.hpp"
+
+namespace Effect {
+
+    // 移動特效走過的位置：固定大小的環狀緩衝區，滿了就蓋掉最舊的 (不配置記憶體)
+    class TrailHistory {
+    public:
+        static constexpr size_t kCapacity = 16;
+        static constexpr float kSampleInterval = 1.0f / 30.0f;  // 取樣間隔 (秒)，約 0.5 秒長的尾跡
+
+        // 經過 deltaTime 後若到了取樣時間就記錄位置
+        void Advance(float deltaTime, const glm::vec2& position) {
+            m_Timer += deltaTime;
+            if (m_Count > 0 && m_Timer < kSampleInterval) return;
+            m_Timer = 0.0f;
+
+            m_Head = (m_Head + 1) % kCapacity;
+            m_Points[m_Head] = position;
+            m_Count = std::min(m_Count + 1, kCapacity);
+        }
+
+        void Clear() {
+            m_Count = 0;
+            m_Timer = 0.0f;
+        }
+
+        size_t GetCount() const { return m_Count; }
+
+        // 第 age 新的位置 (0 為最新)
+        const glm::vec2& GetPoint(size_t age) const {
+            return m_Points[(m_Head + kCapacity - age) % kCapacity];
+        }
+
+    private:
+        std::array<glm::vec2, kCapacity> m_Points{};
+        size_t m_Head = 0;
+        size_t m_Count = 0;
+        float m_Timer = 0.0f;
+    };
+
+} // namespace Effect
+
+#endif // EFFECT_TRAIL_HISTORY_HPP
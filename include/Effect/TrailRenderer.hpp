@@ -0,0 +1,79 @@
+#ifndef EFFECT_TRAIL_RENDERER_HPP
+#define EFFECT_TRAIL_RENDERER_HPP
+
+#include "Effect/TrailHistory.hpp"
+#include "Core/VertexArray.hpp"
+#include "Render/DrawQueue.hpp"
+#include "Render/ShaderProgram.hpp"
+#include "Render/StreamBuffer.hpp"
+#include "Render/UniformTable.hpp"
+
+namespace Effect {
+
+    // 尾跡的頂點：沿著走過的位置展開成兩側的帶狀
+    struct TrailVertex {
+        glm::vec4 positionSide = glm::vec4(0.0f);  // xy: 位置(像素), z: z-index, w: 在哪一側 (-1 / 1)
+        glm::vec4 color = glm::vec4(0.0f);         // 越舊越透明
+    };
+
+    // 尾跡批次繪製器：同 z 的尾跡接成一條 triangle strip (尾跡之間以退化三角形相連)，
+    // 每個 z 一個佇列項目，仍與其他物件依 z 穿插；一幀的頂點經由串流緩衝區一次上傳，每個 z 一次 glDrawArrays
+    class TrailRenderer : public Render::DrawSource {
+    public:
+        static TrailRenderer& GetInstance() {
+            static TrailRenderer instance;
+            return instance;
+        }
+
+        TrailRenderer(const TrailRenderer&) = delete;
+        TrailRenderer& operator=(const TrailRenderer&) = delete;
+
+        // 開始新的一幀 (保留容量，不釋放記憶體)
+        void Begin();
+
+        // 加入一條尾跡：head 為目前位置，history 為過去的位置 (最新的在前)
+        void AddTrail(const TrailHistory& history, const glm::vec2& head, float width,
+                      const glm::vec4& color, float zIndex);
+
+        // 每個尾跡 z 送出一個項目 (排在同 z 的特效之前)
+        void Submit(Render::DrawQueue& queue);
+
+        void DrawRun(const uint32_t* payloads, size_t count) override;
+        void EndFrame() override;
+
+        size_t GetVertexCount() const { return m_Vertices.size(); }
+
+    private:
+        TrailRenderer();
+        ~TrailRenderer() override;
+
+        // 同 z 的尾跡：收集時各自一條 strip，送出時接到 m_Vertices 的 [first, first + count)
+        struct Strip {
+            float zIndex = 0.0f;
+            std::vector<TrailVertex> vertices;
+            size_t first = 0;
+        };
+
+        void InitializeResources();
+        Strip& GetStrip(float zIndex);
+
+        std::unique_ptr<Render::ShaderProgram> m_Program;
+        std::unique_ptr<Render::UniformTable> m_Uniforms;
+        Render::UniformTable::Id m_ProjectionUniform = Render::UniformTable::kInvalid;
+
+        std::unique_ptr<Core::VertexArray> m_VertexArray;
+        std::unique_ptr<Render::StreamBuffer> m_VertexStream;
+        bool m_StreamBegun = false;
+        size_t m_UploadOffset = 0;      // 本幀的頂點在串流緩衝區中的位置 (第一個項目繪製時上傳)
+
+        std::vector<Strip> m_Strips;    // 跨幀保留，只有前 m_StripCount 條在本幀使用
+        size_t m_StripCount = 0;
+        std::vector<TrailVertex> m_Vertices;    // 所有 strip 依序接起來 (上傳用)
+        std::array<glm::vec2, TrailHistory::kCapacity + 1> m_Points{};  // 一條尾跡的點 (含目前位置)
+
+        glm::mat4 m_Projection = glm::mat4(1.0f);
+    };
+
+} // namespace Effect
+
+#endif // EFFECT_TRAIL_RENDERER_HPP
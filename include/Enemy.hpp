@@ -5,6 +5,8 @@
 #include "Util/Renderer.hpp"
 #include "Util/Time.hpp"
 #include "Util/Animation.hpp"
+#include "Render/ShaderProgram.hpp"
+#include "Render/UniformTable.hpp"
 
 #include <set>
 
@@ -33,20 +35,35 @@ public:
     void Update() override;
 
     static std::set<float> s_HealthBarYPositions;
-    void DrawHealthBar(const glm::vec2& position = glm::vec2 (0.9f, 0.9)) const;    // 繪製敵人的血條
+    static constexpr float kHealthBarZIndex = 80.0f;    // 與玩家血條 (HealthBarUI) 同層，在結算畫面之下
+    // 繪製敵人的血條 (送進 DrawQueue，與場景、特效依 z 排序後才畫出)
+    void DrawHealthBar(const glm::vec2& position = glm::vec2 (0.9f, 0.9)) const;
 
     void InitHealthRing();
     void UpdateHealthRing();
     void SetShowHealthRing(bool show) { m_ShowHealthRing = show; }
     bool GetShowHealthRing() const { return m_ShowHealthRing; }
 private:
+    // 本幀要畫的血條：寬度比例與位置 (佇列項目的 payload 是這裡的索引)
+    struct HealthBarDraw {
+        float width;
+        glm::vec2 position;
+    };
+    class HealthBarSource;
 
     static void InitProgram();  // 初始化著色程序（Shader Program）
     static void InitVertexArray();  // 初始化頂點陣列（Vertex Array Object）
-    void InitUniforms();    // 初始化 Uniform 變數（著色器中的全域變數）
+    static void InitUniforms();    // 初始化 Uniform 變數（著色器中的全域變數）
 
-    static std::unique_ptr<Core::Program> s_Program;    // 靜態成員變數：共享的著色程序
+    static std::unique_ptr<Render::ShaderProgram> s_Program;    // 靜態成員變數：共享的著色程序
     static std::unique_ptr<Core::VertexArray> s_VertexArray;    // 靜態成員變數：共享的頂點數據
+    static std::unique_ptr<Render::UniformTable> s_Uniforms;    // 靜態成員變數：血條著色程序的 uniform 表
+    static std::vector<HealthBarDraw> s_HealthBarDraws;         // 靜態成員變數：本幀送出的血條
+
+    // Uniform 索引（顏色、血條寬度與位置）
+    static Render::UniformTable::Id s_ColorUniform;
+    static Render::UniformTable::Id s_WidthUniform;
+    static Render::UniformTable::Id s_PositionUniform;
 
     std::string m_Name;
     float m_Health;
@@ -60,10 +77,6 @@ private:
     glm::vec2 m_Direction = glm::vec2(0.0f, 0.0f);
     glm::vec2 m_TargetPosition = glm::vec2(0.0f, 0.0f);
 
-    // Uniform 變數位置（顏色與血條寬度）
-    GLint m_ColorLocation;
-    GLint m_WidthLocation;
-
     bool m_ShowHealthRing = false;  // 是否顯示血條環
     std::shared_ptr<Util::GameObject> m_HealthRingBackground;  // 半透明背景
     std::vector<std::shared_ptr<Util::GameObject>> m_HealthDots;  // 血條點
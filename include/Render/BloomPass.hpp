@@ -0,0 +1,58 @@
+#ifndef RENDER_BLOOM_PASS_HPP
+#define RENDER_BLOOM_PASS_HPP
+
+#include "pch.hpp"
+#include "Render/RenderTarget.hpp"
+#include "Render/ShaderProgram.hpp"
+#include "Render/UniformTable.hpp"
+
+namespace Render {
+
+    // Bloom 後處理：發光量畫到半解析度的離屏貼圖，
+    // 在四分之一解析度做水平、垂直兩次高斯模糊，最後以加法混合一次疊到畫面上。
+    // 成本只跟畫面大小有關，與發光特效的數量、大小無關。
+    class BloomPass {
+    public:
+        BloomPass();
+        ~BloomPass();
+
+        BloomPass(const BloomPass&) = delete;
+        BloomPass& operator=(const BloomPass&) = delete;
+
+        // 綁定並清空發光貼圖，之後的繪製寫入發光量；資源無效時回傳 false
+        bool BeginEmissive();
+        // 模糊並合成到預設 framebuffer，還原 viewport
+        void Composite();
+
+        void SetIntensity(float intensity) { m_Intensity = intensity; }
+        float GetIntensity() const { return m_Intensity; }
+
+    private:
+        // 視窗大小改變時重建離屏貼圖
+        void Resize(GLint width, GLint height);
+        void Blur(const RenderTarget& source, const RenderTarget& destination, const glm::vec2& direction);
+
+        std::unique_ptr<ShaderProgram> m_BlurProgram;
+        std::unique_ptr<UniformTable> m_BlurUniforms;
+        UniformTable::Id m_SourceUniform = UniformTable::kInvalid;
+        UniformTable::Id m_DirectionUniform = UniformTable::kInvalid;
+
+        std::unique_ptr<ShaderProgram> m_CompositeProgram;
+        std::unique_ptr<UniformTable> m_CompositeUniforms;
+        UniformTable::Id m_BloomUniform = UniformTable::kInvalid;
+        UniformTable::Id m_IntensityUniform = UniformTable::kInvalid;
+
+        GLuint m_VertexArray = 0;   // 全螢幕三角形用的空 VAO (core profile 必須綁定)
+
+        RenderTarget m_Emissive;        // 半解析度
+        RenderTarget m_BlurTargets[2];  // 四分之一解析度，兩張輪流
+        GLint m_Viewport[4] = {0, 0, 0, 0};
+        GLint m_Width = 0;          // 建立時的畫面大小
+        GLint m_Height = 0;
+
+        float m_Intensity = 1.5f;
+    };
+
+} // namespace Render
+
+#endif // RENDER_BLOOM_PASS_HPP
@@ -0,0 +1,54 @@
+#ifndef RENDER_COVERAGE_MASK_HPP
+#define RENDER_COVERAGE_MASK_HPP
+
+#include "pch.hpp"
+#include "Render/RenderTarget.hpp"
+#include "Render/ShaderProgram.hpp"
+#include "Render/UniformTable.hpp"
+
+namespace Render {
+
+    // 降低解析度的覆蓋率遮罩：單通道 (R8) 的離屏貼圖，繪製輸出的 r 以 max 混合累積，
+    // 重疊再多次也只留下最大的覆蓋率 (不會越疊越深)。最後以一組填充與邊緣顏色一次合成，
+    // 邊緣由遮罩的變化量求得，重疊處內部沒有邊，只有整體的外緣
+    class CoverageMask {
+    public:
+        CoverageMask();
+        ~CoverageMask();
+
+        CoverageMask(const CoverageMask&) = delete;
+        CoverageMask& operator=(const CoverageMask&) = delete;
+
+        bool IsValid() const { return m_Program != nullptr; }
+
+        // 每幀開始時呼叫：下一次 Bind 會先清空遮罩
+        void BeginFrame(float scale);
+
+        // 之後的繪製寫入遮罩 (混合方式設為 max)
+        void Bind();
+        // 回到預設 framebuffer，還原 viewport 與框架使用的 alpha 混合
+        void Unbind();
+
+        // 上色後畫到目前的繪製目標 (本幀沒有畫過東西時不做事)。
+        // 輸出一般的 (非預乘) 顏色，混合方式由呼叫端設定
+        void Composite(const glm::vec4& fillColor, const glm::vec4& edgeColor);
+
+    private:
+        std::unique_ptr<ShaderProgram> m_Program;
+        std::unique_ptr<UniformTable> m_Uniforms;
+        UniformTable::Id m_MaskUniform = UniformTable::kInvalid;
+        UniformTable::Id m_TexelSizeUniform = UniformTable::kInvalid;
+        UniformTable::Id m_FillColorUniform = UniformTable::kInvalid;
+        UniformTable::Id m_EdgeColorUniform = UniformTable::kInvalid;
+
+        GLuint m_VertexArray = 0;   // 全螢幕三角形用的空 VAO
+
+        RenderTarget m_Target;
+        GLint m_Viewport[4] = {0, 0, 0, 0};
+        float m_Scale = 1.0f;
+        bool m_Drawn = false;       // 本幀已經清空並畫過
+    };
+
+} // namespace Render
+
+#endif // RENDER_COVERAGE_MASK_HPP
@@ -0,0 +1,80 @@
+#ifndef RENDER_DRAW_QUEUE_HPP
+#define RENDER_DRAW_QUEUE_HPP
+
+#include "pch.hpp"
+
+namespace Render {
+
+    // 繪製來源：能把一段連續的繪製項目一次畫完 (例如同一支程式的特效合成一次 instanced draw)
+    class DrawSource {
+    public:
+        virtual ~DrawSource() = default;
+
+        // 依排序後的順序畫出 payloads (同一來源、排序後相鄰的項目會合成一段)
+        virtual void DrawRun(const uint32_t* payloads, size_t count) = 0;
+
+        // 本幀所有項目都畫完後呼叫一次 (例如替串流緩衝區放 fence)
+        virtual void EndFrame() {}
+    };
+
+    // 排序鍵中的程式欄位：同一個 z 內依此分組，減少切換 program
+    enum class DrawProgram : uint8_t {
+        SPRITE = 0,     // 框架的 Image / Text / Animation
+        TRAIL = 1,      // 移動特效的尾跡 (畫在同 z 的特效本體之前)
+        EFFECT = 2,     // 特效 SDF 著色器
+        PARTICLE = 3,   // 粒子著色器
+        HEALTH_BAR = 4, // 敵人血條著色器
+    };
+
+    // 混合方式欄位 (目前全部是一般的透明度混合)
+    enum class DrawBlend : uint8_t {
+        ALPHA = 0,
+    };
+
+    // 整幀的繪製佇列：每個項目帶一個 64 位元排序鍵，
+    // 由高到低為 z(32) | program(8) | 材質(16) | 混合(8)，
+    // 每幀以基數排序 (穩定) 排一次，相同鍵保留送出順序，再依序畫出。
+    class DrawQueue {
+    public:
+        static DrawQueue& GetInstance() {
+            static DrawQueue instance;
+            return instance;
+        }
+
+        DrawQueue(const DrawQueue&) = delete;
+        DrawQueue& operator=(const DrawQueue&) = delete;
+
+        static uint64_t MakeKey(float z, DrawProgram program, uint16_t material = 0, DrawBlend blend = DrawBlend::ALPHA);
+
+        void Submit(uint64_t key, DrawSource* source, uint32_t payload);
+
+        // 排序並畫出所有項目，然後清空
+        void Flush();
+
+        // 上一次 Flush 的項目數與實際呼叫 DrawRun 的次數
+        size_t GetItemCount() const { return m_LastItemCount; }
+        size_t GetRunCount() const { return m_LastRunCount; }
+
+    private:
+        DrawQueue() = default;
+
+        struct Item {
+            uint64_t key;
+            DrawSource* source;
+            uint32_t payload;
+        };
+
+        void Sort();
+
+        std::vector<Item> m_Items;
+        std::vector<Item> m_Scratch;        // 基數排序的暫存
+        std::vector<uint32_t> m_RunPayloads;
+        std::vector<DrawSource*> m_Sources; // 本幀出現過的來源 (呼叫 EndFrame 用)
+
+        size_t m_LastItemCount = 0;
+        size_t m_LastRunCount = 0;
+    };
+
+} // namespace Render
+
+#endif // RENDER_DRAW_QUEUE_HPP
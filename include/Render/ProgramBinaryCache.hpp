@@ -0,0 +1,56 @@
+#ifndef RENDER_PROGRAM_BINARY_CACHE_HPP
+#define RENDER_PROGRAM_BINARY_CACHE_HPP
+
+#include "pch.hpp"
+
+namespace Render {
+
+    // 連結好的著色程序二進位快取 (glGetProgramBinary / glProgramBinary)。
+    // 以著色器原始碼 (含變體定義) 與驅動字串的雜湊為鍵，每個程序存成快取目錄下的一個檔案；
+    // 驅動更新或原始碼改變時鍵值不同，載入失敗時由呼叫端改回正常編譯。
+    class ProgramBinaryCache {
+    public:
+        static ProgramBinaryCache& GetInstance() {
+            static ProgramBinaryCache instance;
+            return instance;
+        }
+
+        ProgramBinaryCache(const ProgramBinaryCache&) = delete;
+        ProgramBinaryCache& operator=(const ProgramBinaryCache&) = delete;
+
+        // 設定快取目錄 (需在 GL context 建立之後)；驅動不支援二進位格式時停用快取
+        void SetDirectory(const std::string& directory);
+        bool IsEnabled() const { return m_Enabled; }
+
+        // 原始碼的快取鍵 (已混入驅動字串)
+        uint64_t MakeKey(const std::string& source) const;
+
+        // 從快取載入到 program；成功時 program 已連結完成
+        bool Load(GLuint program, uint64_t key);
+        // 連結成功後存入快取 (連結前需呼叫 PrepareForLink)
+        void Store(GLuint program, uint64_t key) const;
+        // 讓驅動保留可取回的二進位
+        void PrepareForLink(GLuint program) const;
+
+        // 累計的命中、未命中 (含被拒絕) 次數
+        size_t GetHitCount() const { return m_Hits; }
+        size_t GetMissCount() const { return m_Misses; }
+
+    private:
+        ProgramBinaryCache() = default;
+
+        std::string GetPath(uint64_t key) const;
+
+        static uint64_t Hash(const std::string& text, uint64_t seed);
+
+        std::string m_Directory;
+        uint64_t m_DriverHash = 0;
+        bool m_Enabled = false;
+
+        size_t m_Hits = 0;
+        size_t m_Misses = 0;
+    };
+
+} // namespace Render
+
+#endif // RENDER_PROGRAM_BINARY_CACHE_HPP
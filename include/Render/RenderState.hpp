@@ -0,0 +1,91 @@
+#ifndef RENDER_RENDER_STATE_HPP
+#define RENDER_RENDER_STATE_HPP
+
+#include "pch.hpp"
+#include "Render/ShaderProgram.hpp"
+#include "Core/VertexArray.hpp"
+
+namespace Render {
+
+    // GL 狀態快取：記住目前綁定的 program、VAO、貼圖與混合狀態，
+    // 只有在狀態改變時才真的呼叫 GL。
+    // 框架 (PTSD) 的繪製不經過這裡，所以在它畫過東西之後要呼叫 InvalidateBindings()。
+    class RenderState {
+    public:
+        static RenderState& GetInstance() {
+            static RenderState instance;
+            return instance;
+        }
+
+        RenderState(const RenderState&) = delete;
+        RenderState& operator=(const RenderState&) = delete;
+
+        // 每幀開始時呼叫：保存上一幀的統計並清空所有快取
+        void BeginFrame();
+
+        // 綁定狀態已被外部改動 (框架的 Image/Text 繪製)
+        void InvalidateBindings();
+
+        void UseProgram(const ShaderProgram& program);
+        void UseProgram(GLuint program);  // 由 ShaderPermutations 管理的變體
+        void BindVertexArray(const Core::VertexArray& vertexArray);
+        void BindTexture(GLuint texture, GLuint unit = 0);
+
+        void SetBlend(bool enabled);
+        void SetBlendFunc(GLenum source, GLenum destination);
+        // 顏色與 alpha 分開的混合方式 (離屏圖層以預乘 alpha 累積)
+        void SetBlendFuncSeparate(GLenum sourceColor, GLenum destinationColor,
+                                  GLenum sourceAlpha, GLenum destinationAlpha);
+
+        // 只在 debug 版本驗證著色程序 (release 版本不做驅動驗證)
+        void Validate(const ShaderProgram& program) const;
+
+        // 上一幀實際發出與被略過的狀態變更次數
+        size_t GetIssuedCount() const { return m_LastIssued; }
+        size_t GetElidedCount() const { return m_LastElided; }
+
+    private:
+        RenderState() = default;
+
+        // 狀態相同時記為略過並回傳 false
+        template <typename T>
+        bool Change(T& current, const T& next) {
+            if (current == next) {
+                ++m_Elided;
+                return false;
+            }
+            current = next;
+            ++m_Issued;
+            return true;
+        }
+
+        static constexpr GLuint kTextureUnits = 8;
+        static constexpr GLuint kUnknown = ~0u;
+
+        GLuint m_Program = kUnknown;
+        const Core::VertexArray* m_VertexArray = nullptr;  // PTSD 不公開 VAO id，以物件位址辨識
+        GLuint m_ActiveUnit = kUnknown;
+        std::array<GLuint, kTextureUnits> m_Textures = MakeUnknownTextures();
+
+        int m_Blend = -1;                                   // -1: 未知, 0: 關閉, 1: 開啟
+        std::array<GLenum, 4> m_BlendFunc = MakeUnknownBlendFunc();  // 顏色 src/dst, alpha src/dst
+
+        size_t m_Issued = 0;
+        size_t m_Elided = 0;
+        size_t m_LastIssued = 0;
+        size_t m_LastElided = 0;
+
+        static std::array<GLenum, 4> MakeUnknownBlendFunc() {
+            return {GL_NONE, GL_NONE, GL_NONE, GL_NONE};
+        }
+
+        static std::array<GLuint, kTextureUnits> MakeUnknownTextures() {
+            std::array<GLuint, kTextureUnits> textures{};
+            textures.fill(kUnknown);
+            return textures;
+        }
+    };
+
+} // namespace Render
+
+#endif // RENDER_RENDER_STATE_HPP
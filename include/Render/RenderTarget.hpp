@@ -0,0 +1,38 @@
+#ifndef RENDER_RENDER_TARGET_HPP
+#define RENDER_RENDER_TARGET_HPP
+
+#include "pch.hpp"
+
+namespace Render {
+
+    // 離屏繪製目標：一個 framebuffer 加上一張線性過濾的顏色貼圖
+    class RenderTarget {
+    public:
+        RenderTarget() = default;
+        ~RenderTarget() { Destroy(); }
+
+        RenderTarget(const RenderTarget&) = delete;
+        RenderTarget& operator=(const RenderTarget&) = delete;
+
+        // 重新建立為指定大小 (已存在時先釋放)
+        void Create(GLint width, GLint height, GLenum internalFormat, GLenum type);
+        void Destroy();
+
+        // 綁定為繪製目標並設定 viewport 為整張貼圖
+        void Bind() const;
+
+        GLuint GetTexture() const { return m_Texture; }
+        GLint GetWidth() const { return m_Width; }
+        GLint GetHeight() const { return m_Height; }
+        bool IsValid() const { return m_Framebuffer != 0; }
+
+    private:
+        GLuint m_Framebuffer = 0;
+        GLuint m_Texture = 0;
+        GLint m_Width = 0;
+        GLint m_Height = 0;
+    };
+
+} // namespace Render
+
+#endif // RENDER_RENDER_TARGET_HPP
@@ -0,0 +1,50 @@
+#ifndef RENDER_SCALED_LAYER_HPP
+#define RENDER_SCALED_LAYER_HPP
+
+#include "pch.hpp"
+#include "Render/RenderTarget.hpp"
+#include "Render/ShaderProgram.hpp"
+#include "Render/UniformTable.hpp"
+
+namespace Render {
+
+    // 降低解析度的離屏圖層：圖層內容畫在 (畫面大小 × scale) 的貼圖上，
+    // 以預乘 alpha 累積，最後線性過濾放大一次疊回畫面。
+    // 適合邊緣本來就柔和的內容 (SDF 特效)，片段數量約為原本的 scale²。
+    class ScaledLayer {
+    public:
+        ScaledLayer();
+        ~ScaledLayer();
+
+        ScaledLayer(const ScaledLayer&) = delete;
+        ScaledLayer& operator=(const ScaledLayer&) = delete;
+
+        bool IsValid() const { return m_Program != nullptr; }
+
+        // 每幀開始時呼叫：下一次 Bind 會先清空圖層
+        void BeginFrame(float scale);
+
+        // 之後的繪製寫入圖層 (混合方式設為預乘 alpha 累積)
+        void Bind();
+        // 回到預設 framebuffer，還原 viewport 與框架使用的 alpha 混合
+        void Unbind();
+
+        // 放大疊回畫面 (本幀沒有畫過東西時不做事)
+        void Composite();
+
+    private:
+        std::unique_ptr<ShaderProgram> m_Program;
+        std::unique_ptr<UniformTable> m_Uniforms;
+        UniformTable::Id m_LayerUniform = UniformTable::kInvalid;
+
+        GLuint m_VertexArray = 0;   // 全螢幕三角形用的空 VAO
+
+        RenderTarget m_Target;
+        GLint m_Viewport[4] = {0, 0, 0, 0};
+        float m_Scale = 1.0f;
+        bool m_Drawn = false;       // 本幀已經清空並畫過
+    };
+
+} // namespace Render
+
+#endif // RENDER_SCALED_LAYER_HPP
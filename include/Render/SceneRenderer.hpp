@@ -0,0 +1,46 @@
+#ifndef RENDER_SCENE_RENDERER_HPP
+#define RENDER_SCENE_RENDERER_HPP
+
+#include "Render/DrawQueue.hpp"
+#include "Util/GameObject.hpp"
+
+namespace Render {
+
+    // 場景來源：每幀把自己的繪製項目送進佇列 (例如特效管理器)
+    class SceneSource {
+    public:
+        virtual ~SceneSource() = default;
+        virtual void Submit(DrawQueue& queue) = 0;
+    };
+
+    // 取代 Util::Renderer 的場景根節點：介面相同，
+    // 但物件不直接畫，而是和特效一起送進 DrawQueue 依 z 排序後畫出，
+    // 所以特效的 z-index 可以穿插在角色與 UI 之間。
+    class SceneRenderer : public DrawSource {
+    public:
+        SceneRenderer() = default;
+
+        void AddChild(const std::shared_ptr<Util::GameObject>& child);
+        void AddChildren(const std::vector<std::shared_ptr<Util::GameObject>>& children);
+        void RemoveChild(const std::shared_ptr<Util::GameObject>& child);
+
+        // 每幀都會送出項目的其他來源 (不持有)
+        void AddSource(SceneSource* source);
+
+        // 收集所有物件與來源的項目，排序後畫出
+        void Update();
+
+        void DrawRun(const uint32_t* payloads, size_t count) override;
+
+    private:
+        std::vector<std::shared_ptr<Util::GameObject>> m_Children;
+        std::vector<SceneSource*> m_Sources;
+
+        // 本幀收集到的物件 (項目的 payload 是這裡的索引)
+        std::vector<Util::GameObject*> m_FrameObjects;
+        std::vector<Util::GameObject*> m_Stack;
+    };
+
+} // namespace Render
+
+#endif // RENDER_SCENE_RENDERER_HPP
@@ -0,0 +1,34 @@
+#ifndef RENDER_SHADER_PERMUTATIONS_HPP
+#define RENDER_SHADER_PERMUTATIONS_HPP
+
+#include "pch.hpp"
+#include "Render/ShaderProgram.hpp"
+
+namespace Render {
+
+    // 同一組著色器檔案的編譯期變體：原始碼只讀一次，
+    // 每個變體在 #version 之後插入自己的 #define 再編譯成獨立的 program，依鍵值快取。
+    // (Core::Program 只接受檔案路徑，沒辦法加定義，所以用 ShaderProgram)
+    class ShaderPermutations {
+    public:
+        ShaderPermutations(const std::string& vertexPath, const std::string& fragmentPath);
+
+        ShaderPermutations(const ShaderPermutations&) = delete;
+        ShaderPermutations& operator=(const ShaderPermutations&) = delete;
+
+        // 取得變體，第一次使用時編譯；編譯失敗回傳 0 (失敗也會記住，不會每幀重試)
+        GLuint Get(uint32_t key, const std::string& defines);
+        bool Has(uint32_t key) const { return m_Programs.count(key) != 0; }
+
+        // 已編譯的變體數量
+        size_t GetSize() const { return m_Programs.size(); }
+
+    private:
+        ShaderSource m_Vertex;
+        ShaderSource m_Fragment;
+        std::unordered_map<uint32_t, std::unique_ptr<ShaderProgram>> m_Programs;  // 失敗的變體存 nullptr
+    };
+
+} // namespace Render
+
+#endif // RENDER_SHADER_PERMUTATIONS_HPP
@@ -0,0 +1,46 @@
+#ifndef RENDER_SHADER_PROGRAM_HPP
+#define RENDER_SHADER_PROGRAM_HPP
+
+#include "pch.hpp"
+
+namespace Render {
+
+    // 著色器原始碼 (路徑只用於錯誤訊息)
+    struct ShaderSource {
+        std::string path;
+        std::string text;
+
+        static ShaderSource FromFile(const std::string& path);
+    };
+
+    // 著色程序：介面與 Core::Program 相同，但連結結果會經過 ProgramBinaryCache，
+    // 有快取時直接載入二進位，不必重新編譯。可在 #version 之後插入變體定義。
+    // 編譯或連結失敗時丟出 std::runtime_error。
+    class ShaderProgram {
+    public:
+        ShaderProgram(const std::string& vertexPath, const std::string& fragmentPath);
+        ShaderProgram(const ShaderSource& vertex, const ShaderSource& fragment, const std::string& defines = "");
+        ~ShaderProgram();
+
+        ShaderProgram(const ShaderProgram&) = delete;
+        ShaderProgram& operator=(const ShaderProgram&) = delete;
+
+        GLuint GetId() const { return m_Id; }
+        void Bind() const { glUseProgram(m_Id); }
+        void Unbind() const { glUseProgram(0); }
+        void Validate() const;
+
+        // 這次是從二進位快取載入的
+        bool IsFromCache() const { return m_FromCache; }
+
+    private:
+        static GLuint CompileShader(GLenum type, const ShaderSource& source, const std::string& defines);
+        void Link(const ShaderSource& vertex, const ShaderSource& fragment, const std::string& defines);
+
+        GLuint m_Id = 0;
+        bool m_FromCache = false;
+    };
+
+} // namespace Render
+
+#endif // RENDER_SHADER_PROGRAM_HPP
@@ -0,0 +1,59 @@
+#ifndef RENDER_STREAM_BUFFER_HPP
+#define RENDER_STREAM_BUFFER_HPP
+
+#include "pch.hpp"
+
+namespace Render {
+
+    // 串流緩衝區：一個 GL buffer 切成 N 段，每幀寫一段，輪流使用 (ring)。
+    // 寫入時以 GL_MAP_UNSYNCHRONIZED_BIT 映射，不讓驅動等待；
+    // 改以每段一個 fence 確認 GPU 已經用完，再覆寫同一段。
+    // (GL 4.1 沒有 persistent mapping，所以每次寫入都 map / unmap 一次)
+    class StreamBuffer {
+    public:
+        static constexpr size_t kFramesInFlight = 3;
+        static constexpr size_t kInvalidOffset = static_cast<size_t>(-1);
+
+        StreamBuffer(GLenum target, size_t frameCapacity, size_t alignment = 16);
+        ~StreamBuffer();
+
+        StreamBuffer(const StreamBuffer&) = delete;
+        StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+        // 換到下一段，必要時等待 GPU 讀完該段
+        void BeginFrame();
+
+        // 寫入資料，回傳在 buffer 中的位元組偏移 (呼叫後 buffer 保持綁定)
+        // 超過本段容量時回傳 kInvalidOffset
+        size_t Upload(const void* data, size_t bytes);
+
+        // 本幀的繪製都已送出，替這一段放置 fence
+        void EndFrame();
+
+        // 確保每段至少有 bytes 的容量 (只能在 BeginFrame 之前呼叫，會重建 buffer)
+        void Reserve(size_t bytes);
+
+        GLuint GetId() const { return m_Buffer; }
+        size_t GetFrameCapacity() const { return m_FrameCapacity; }
+
+        // 累計等待 fence 的次數 (代表 CPU 跑在 GPU 前面太多幀)
+        size_t GetStallCount() const { return m_StallCount; }
+
+    private:
+        void Allocate();
+        void ReleaseFences();
+
+        GLenum m_Target;
+        GLuint m_Buffer = 0;
+        size_t m_Alignment;
+        size_t m_FrameCapacity;         // 每段的位元組數
+        size_t m_Segment = 0;           // 目前寫入的段
+        size_t m_Cursor = 0;            // 本段已使用的位元組數
+        std::array<GLsync, kFramesInFlight> m_Fences{};
+
+        size_t m_StallCount = 0;
+    };
+
+} // namespace Render
+
+#endif // RENDER_STREAM_BUFFER_HPP
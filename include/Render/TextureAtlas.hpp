@@ -0,0 +1,86 @@
+#ifndef RENDER_TEXTURE_ATLAS_HPP
+#define RENDER_TEXTURE_ATLAS_HPP
+
+#include "pch.hpp"
+#include "Render/RenderTarget.hpp"
+
+namespace Render {
+
+    // 執行中烘焙的貼圖集：一張 RGBA8 繪製目標，以貨架 (shelf) 方式由左而右、由下而上配置區塊，
+    // 以 64 位元的外觀編號查詢已烘焙的項目。區塊之間留邊距，線性過濾不會取到鄰居。
+    // 每個項目記錄最後使用的幀；放滿之後只回收一段時間沒用到的項目，新的外觀重用它們的區塊。
+    // 沒有可回收的區塊時配置失敗，由呼叫端改用其他方式繪製，仍在使用的項目不會被清掉
+    class TextureAtlas {
+    public:
+        static constexpr GLint kPadding = 2;
+        static constexpr uint32_t kStaleFrames = 120;   // 超過這麼多幀沒用到的項目可以回收
+
+        struct Region {
+            GLint x = 0;
+            GLint y = 0;
+            GLint width = 0;
+            GLint height = 0;
+            // 實際佔用的大小 (不含邊距)；重用回收的區塊時可能比 width × height 大
+            GLint slotWidth = 0;
+            GLint slotHeight = 0;
+        };
+
+        explicit TextureAtlas(GLint size);
+
+        TextureAtlas(const TextureAtlas&) = delete;
+        TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+        bool IsValid() const { return m_Target.IsValid(); }
+
+        // 每幀開始時呼叫：推進幀數 (判斷項目是否久未使用)
+        void BeginFrame() { ++m_Frame; }
+
+        // 已烘焙項目的 UV 範圍 (u0, v0, u1, v1)，並標記為本幀使用；沒有時回傳 nullptr
+        const glm::vec4* Find(uint64_t key);
+
+        // 配置一塊 width × height 的區塊 (不含邊距)：先用貨架的剩餘空間，放滿後重用久未使用的項目的區塊；
+        // 都放不下時回傳 false
+        bool Allocate(GLint width, GLint height, Region& region);
+
+        // 綁定為繪製目標，清空區塊 (含邊距) 並只允許寫入該範圍 (開啟 scissor)
+        void BeginRegion(const Region& region) const;
+        // 關閉 scissor，回到預設 framebuffer (viewport 由呼叫端還原)
+        void EndRegion() const;
+
+        // 記錄區塊的 UV 範圍；回傳的參考在項目被回收前都有效
+        const glm::vec4& Insert(uint64_t key, const Region& region);
+
+        GLuint GetTexture() const { return m_Target.GetTexture(); }
+        GLint GetSize() const { return m_Size; }
+        size_t GetEntryCount() const { return m_Entries.size(); }
+
+    private:
+        struct Entry {
+            glm::vec4 uvRect;
+            Region region;
+            uint32_t lastUsed = 0;
+        };
+
+        bool AllocateShelf(GLint width, GLint height, Region& region);
+        // 從回收的區塊中找放得下的最小一塊
+        bool AllocateFree(GLint width, GLint height, Region& region);
+        // 把久未使用的項目的區塊移到回收清單；回傳回收的數量
+        size_t EvictStale();
+
+        RenderTarget m_Target;
+        GLint m_Size = 0;
+        std::unordered_map<uint64_t, Entry> m_Entries;
+        std::vector<Region> m_FreeRegions;
+        uint32_t m_Frame = 0;
+        uint32_t m_EvictFrame = 0;      // 上次嘗試回收的幀，一幀只掃描一次
+
+        // 目前的貨架：下緣、高度，以及下一塊的左緣
+        GLint m_ShelfX = 0;
+        GLint m_ShelfY = 0;
+        GLint m_ShelfHeight = 0;
+        bool m_ShelfFull = false;       // 貨架已用完，之後只能重用回收的區塊
+    };
+
+} // namespace Render
+
+#endif // RENDER_TEXTURE_ATLAS_HPP
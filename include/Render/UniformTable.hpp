@@ -0,0 +1,59 @@
+#ifndef RENDER_UNIFORM_TABLE_HPP
+#define RENDER_UNIFORM_TABLE_HPP
+
+#include "pch.hpp"
+
+namespace Render {
+
+    // Uniform 反射表：程式連結後列出所有活躍的 uniform，位置只查詢一次。
+    // 每個 uniform 會記住上一次上傳的值，值沒變就不呼叫 glUniform*。
+    // (uniform 的值屬於 program 本身，所以快取在切換 program 之後仍然有效)
+    class UniformTable {
+    public:
+        using Id = int;                    // 表內索引，-1 代表找不到
+        static constexpr Id kInvalid = -1;
+
+        explicit UniformTable(GLuint program);
+
+        // 初始化時取得 uniform 的索引 (陣列可用 "u_Name" 或 "u_Name[0]")
+        Id Find(const std::string& name) const;
+        bool Has(const std::string& name) const { return Find(name) != kInvalid; }
+
+        // 設定 uniform，呼叫前 program 必須已經綁定；無效的 id 會被忽略
+        void Set(Id id, int value);
+        void Set(Id id, float value);
+        void Set(Id id, const glm::vec2& value);
+        void Set(Id id, const glm::vec4& value);
+        void Set(Id id, const glm::mat4& value);
+
+        // 讓快取失效 (例如其他程式碼直接改過 uniform)
+        void Invalidate();
+
+        GLuint GetProgram() const { return m_Program; }
+        size_t GetSize() const { return m_Entries.size(); }
+
+        // 上傳與略過的次數 (累計)
+        size_t GetUploadCount() const { return m_UploadCount; }
+        size_t GetSkippedCount() const { return m_SkippedCount; }
+
+    private:
+        struct Entry {
+            std::string name;
+            GLint location = -1;
+            std::array<float, 16> value{};  // 上一次上傳的值 (int 以位元複製保存)
+            bool hasValue = false;
+        };
+
+        // 與上次的值相同時回傳 false，否則更新快取並回傳 true
+        bool Changed(Id id, const void* data, size_t bytes);
+
+        GLuint m_Program = 0;
+        std::vector<Entry> m_Entries;
+
+        size_t m_UploadCount = 0;
+        size_t m_SkippedCount = 0;
+    };
+
+} // namespace Render
+
+#endif // RENDER_UNIFORM_TABLE_HPP
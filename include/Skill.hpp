@@ -55,7 +55,7 @@ private:
     float m_EffectRadius = 0.4f;
     Util::Color m_EffectColor = Util::Color::FromName(Util::Colors::WHITE);
     glm::vec2 m_EffectSize = {800, 800};
-    std::shared_ptr<Effect::IEffect> m_CurrentEffect = nullptr; // 只是用在追蹤 看之後要不要用
+    Effect::EffectHandle m_CurrentEffect; // 只是用在追蹤 看之後要不要用
 
 
     float m_Cooldown = 2.0f;       // 冷卻時間（秒）
@@ -3,4 +3,8 @@
 
 void App::End() { // NOLINT(this method will mutate members in the future)
     LOG_TRACE("End");
+
+    // 寫回特效對象池的使用紀錄，下次啟動時用來預先配置
+    Effect::EffectManager::GetInstance().SavePoolProfile();
+    Effect::EffectManager::GetInstance().LogLeakReport();
 }
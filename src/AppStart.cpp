@@ -2,19 +2,32 @@
 
 #include "Util/Logger.hpp"
 #include "Effect/EffectManager.hpp"
+#include "Render/ProgramBinaryCache.hpp"
 #include "Attack/EnemyAttackController.hpp"
 #include "Attack/AttackManager.hpp" // 添加攻擊管理器
 
 void App::Start() {
     LOG_TRACE("Start");
 
+    // 連結好的著色程序存成二進位，之後啟動直接載入，不必每次重新編譯
+    Render::ProgramBinaryCache::GetInstance().SetDirectory(GA_RESOURCE_DIR "/shader_cache");
+
     // 初始化特效管理器（預先創建10個每種類型的特效）
-    Effect::EffectManager::GetInstance().Initialize(10);
-    auto zEffect = Effect::EffectManager::GetInstance().GetEffect(Effect::EffectType::SKILL_Z);
-    zEffect->Play({-9999, -9999}, -100);
+    // 有使用紀錄時依紀錄的最大使用數量配置，沒有紀錄的類型才用預設的 10 個
+    auto& effects = Effect::EffectManager::GetInstance();
+    // 發光邊緣改用 bloom 後處理 (關閉時回到每個特效在著色器內各自提高亮度)
+    Effect::EffectBatchRenderer::GetInstance().SetBloomEnabled(true);
+    // 重疊的預警範圍併成一張遮罩一次上色 (資料檔中標了 telegraph 的原型)
+    Effect::EffectBatchRenderer::GetInstance().SetTelegraphMaskEnabled(true);
+    // 特效外觀 (內建類型與具名原型) 由資料檔定義，改外觀不必重新編譯
+    Effect::EffectLibrary::GetInstance().Load(GA_RESOURCE_DIR "/effects.def");
+    effects.LoadPoolProfile(GA_RESOURCE_DIR "/effect_pool.profile");
+    effects.Initialize(10);  // 同時載入各類型特效的著色器變體，不再需要播放暖身特效
+    // 飛出場地 (畫面外 200 像素) 的彈幕不必等移動距離用完
+    effects.SetAutoRetire(true);
 
     // 將特效管理器添加到渲染樹
-    m_Root.AddChild(std::shared_ptr<Util::GameObject>(&Effect::EffectManager::GetInstance(), [](Util::GameObject*){}));
+    m_Root.AddSource(&Effect::EffectManager::GetInstance());
 
     std::vector<std::string> rabbitImages;
     rabbitImages.reserve(2);
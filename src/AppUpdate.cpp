@@ -10,11 +10,29 @@
 #include "Attack/AttackManager.hpp"
 #include "Attack/CircleAttack.hpp"
 #include "Attack/RectangleAttack.hpp"
+#include "Render/RenderState.hpp"
+#include "Render/ProgramBinaryCache.hpp"
 
 void App::Update() {
     // 獲取時間增量
     const float deltaTime = Util::Time::GetDeltaTimeMs() / 1000.0f;
 
+    // 新的一幀，GL 狀態快取從未知開始
+    Render::RenderState::GetInstance().BeginFrame();
+
+    // Start() 之後已經顯示過第一幀，記錄冷啟動花了多久
+    if (!m_FirstFrameLogged) {
+        m_FirstFrameLogged = true;
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - m_LaunchTime);
+        const auto& cache = Render::ProgramBinaryCache::GetInstance();
+        LOG_INFO("Time to first frame: {} ms (programs: {} from binary cache, {} compiled)",
+                 elapsed.count(), cache.GetHitCount(), cache.GetMissCount());
+    }
+
+    // 依最近的幀時間調整特效品質 (太慢時關閉發光、動畫等)
+    Effect::QualityGovernor::GetInstance().Update(deltaTime);
+
     if (!m_IsReady) {
         GetReady();
         return;
@@ -32,6 +50,9 @@ void App::Update() {
         return;
     }
 
+    // 這一幀的特效取用都記在目前的關卡底下
+    Effect::EffectManager::GetInstance().SetProfilePhase(m_PRM->GetCurrentMainPhase(), m_PRM->GetCurrentSubPhase());
+
 
     // 角色移動
     constexpr float moveSpeed = 5.0f; // 調整移動速度
@@ -156,7 +177,7 @@ void App::Update() {
     // 更新兔子角色
     m_Rabbit->Update();
 
-    // 更新敵人血條，是否允許(前進)
+    // 更新敵人血條 (送進繪製佇列，在 m_Root 更新時依 z 畫出)，是否允許(前進)
     for (const auto& enemy : m_Enemies) {// 遍歷範圍內的敵人
         enemy->DrawHealthBar();
     }
@@ -226,7 +247,7 @@ void App::Update() {
     //
     //     // 獲取標準自動旋轉特效
     //     auto effect1 = Effect::EffectManager::GetInstance().GetEffect(Effect::EffectType::RECT_BEAM);
-    //     auto rectangleShape = std::dynamic_pointer_cast<Effect::Shape::RectangleShape>(effect1->GetBaseShape());
+    //     auto rectangleShape = effect1->GetShape<Effect::Shape::RectangleShape>();
     //     rectangleShape->SetRotation(0.0f);
     //     effect1->SetDuration(10.0f);
     //     effect1->Play(cursorPos, 20.0f);
@@ -234,7 +255,7 @@ void App::Update() {
     //
     //     // 創建一個新的自定義光束特效 - 從工廠獲取類似的基本特效
     //     auto effect2 = Effect::EffectManager::GetInstance().GetEffect(Effect::EffectType::RECT_BEAM);
-    //     if (auto rectangleShape = std::dynamic_pointer_cast<Effect::Shape::RectangleShape>(effect2->GetBaseShape())) {
+    //     if (auto rectangleShape = effect2->GetShape<Effect::Shape::RectangleShape>()) {
     //         // 設置90度旋轉 (π/2 弧度)
     //         rectangleShape->SetRotation(1.57f);
     //         effect2->SetDuration(10.0f);
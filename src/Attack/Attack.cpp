@@ -79,8 +79,8 @@ void Attack::SetPosition(const glm::vec2& position) {
     m_Transform.translation = position;
 
     // 如果已經創建了特效，也要更新它們的位置
-    if (m_WarningEffect) {
-        m_WarningEffect->Play(position, m_ZIndex + 0.1f);
+    if (auto warningEffect = m_WarningEffect.Get()) {
+        warningEffect->Play(position, m_ZIndex + 0.1f);
     }
 
     if (m_SequenceText) {
@@ -158,13 +158,8 @@ void Attack::OnCountdownUpdate(float deltaTime) {
 void Attack::OnAttackStart() {
     CreateAttackEffect();
 
-    if (m_WarningEffect) {
-        m_WarningEffect->Reset();
-    }
-
-    if (m_TimeBarEffect) {
-        m_TimeBarEffect->Reset();
-    }
+    m_WarningEffect.Release();
+    m_TimeBarEffect.Release();
     CleanupVisuals();
 }
 
@@ -174,7 +169,8 @@ void Attack::OnAttackUpdate(float deltaTime) {
         CheckCollision(m_TargetCharacter);
     }
 
-    if (m_AttackEffect && m_AttackEffect->IsFinished()) {
+    // 攻擊特效播完後已被管理器回收 (代號失效)，重新建立一個
+    if (m_AttackEffect.IsExpired()) {
         CreateAttackEffect();
     }
 }
@@ -182,35 +178,19 @@ void Attack::OnAttackUpdate(float deltaTime) {
 // 完成階段開始
 void Attack::OnFinishedStart() {
     // 清理所有特效
-    if (m_AttackEffect) {
-        m_AttackEffect->Reset();
-    }
+    m_AttackEffect.Release();
 
     LOG_DEBUG("Attack finished at position ({}, {})", m_Position.x, m_Position.y);
 }
 
 // 創建時間條
 void Attack::CreateTimeBar() {
-    // 使用矩形特效創建一個時間條
-    auto rectangleEffect = Effect::EffectManager::GetInstance().GetEffect(Effect::EffectType::RECT_BEAM);
-
-    // 設置時間條的屬性
-    if (auto rectangleShape = std::dynamic_pointer_cast<Effect::Shape::RectangleShape>(rectangleEffect->GetBaseShape())) {
-        rectangleShape->SetDimensions(glm::vec2(1.0f, 0.1f)); // 寬高比
-        rectangleShape->SetSize({200.0, 200.0});
-        rectangleShape->SetRotation(0.0f); // 不旋轉
-        rectangleShape->SetAutoRotation(false); // 禁用自動旋
-    }
-
-    // 設置填充與邊緣效果
-    rectangleEffect->SetFillModifier(Effect::Modifier::FillModifier(Effect::Modifier::FillType::SOLID));
-    rectangleEffect->SetEdgeModifier(Effect::Modifier::EdgeModifier(
-        Effect::Modifier::EdgeType::GLOW,
-        0.005f,
-        Util::Color::FromName(Util::Colors::WHITE)
-    ));
-
-    rectangleEffect->GetBaseShape()->SetColor(Util::Color(0.9, 0.9, 0.9, 0.5));
+    // 時間條的形狀、顏色與修飾器定義在 effects.def 的 timebar
+    static const Effect::PrototypeId kTimeBar =
+        Effect::EffectLibrary::GetInstance().Find("timebar", Effect::EffectType::RECT_BEAM);
+    auto& effects = Effect::EffectManager::GetInstance();
+    auto lease = effects.LeaseEffect(kTimeBar);
+    auto rectangleEffect = lease.Get();
 
     // 設置位置 - 在警告效果下方
     glm::vec2 barPosition = m_Position;
@@ -220,15 +200,16 @@ void Attack::CreateTimeBar() {
     rectangleEffect->SetDuration(m_Delay);
     rectangleEffect->Play(barPosition, m_ZIndex + 1.0f);
 
-    m_TimeBarEffect = rectangleEffect;
+    m_TimeBarEffect = std::move(lease);
 }
 
 // 更新時間條
 void Attack::UpdateTimeBar(float progress) {
-    if (!m_TimeBarEffect) return;
+    auto timeBarEffect = m_TimeBarEffect.Get();
+    if (!timeBarEffect) return;
 
     // 根據進度更新時間條的寬度和顏色
-    if (auto rectangleShape = std::dynamic_pointer_cast<Effect::Shape::RectangleShape>(m_TimeBarEffect->GetBaseShape())) {
+    if (auto rectangleShape = timeBarEffect->GetShape<Effect::Shape::RectangleShape>()) {
         // 更新寬度
         float width = 0.8f * (1.0f - progress);
         rectangleShape->SetDimensions(glm::vec2(width, 0.05f));
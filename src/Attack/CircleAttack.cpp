@@ -14,33 +14,24 @@ CircleAttack::CircleAttack(const glm::vec2& position, float delay, float radius,
 
 void CircleAttack::CreateWarningEffect() {
     try {
-        // 獲取圓形警告特效
-        auto warningEffect = Effect::EffectManager::GetInstance().GetEffect(Effect::EffectType::ENEMY_ATTACK_2);
-
-        // 配置特效參數
-        if (auto circleShape = std::dynamic_pointer_cast<Effect::Shape::CircleShape>(warningEffect->GetBaseShape())) {
-            // 調整為適合半徑的相對尺寸
-            float normalizedRadius = 0.35f;  // 預設歸一化半徑
-            circleShape->SetRadius(normalizedRadius);
-
-            // 設置視覺大小以匹配實際半徑
+        // 獲取圓形警告特效 (顏色與修飾器定義在 effects.def 的 circle_warning)
+        static const Effect::PrototypeId kWarning =
+            Effect::EffectLibrary::GetInstance().Find("circle_warning", Effect::EffectType::ENEMY_ATTACK_2);
+        auto& effects = Effect::EffectManager::GetInstance();
+        auto lease = effects.LeaseEffect(kWarning);
+        auto warningEffect = lease.Get();
+
+        // 設置視覺大小以匹配實際半徑
+        if (auto circleShape = warningEffect->GetShape<Effect::Shape::CircleShape>()) {
             float visualSize = m_Radius * 2.5f;
             circleShape->SetSize({visualSize, visualSize});
-
-            // 設置顏色 - 半透明紅色用於警告
-            circleShape->SetColor(Util::Color(1.0, 0.0, 0.0, 0.2));
-            circleShape->SetDuration(m_Delay + 1.0f);
         }
 
-        // 設置填充與邊緣效果
-        warningEffect->SetFillModifier(Effect::Modifier::FillModifier(Effect::Modifier::FillType::SOLID));
-        warningEffect->SetEdgeModifier(Effect::Modifier::EdgeModifier(Effect::Modifier::EdgeType::GLOW, 0.005, Util::Color(1.0, 0.0, 0.0, 0.7)));
-
         // 設置持續時間和播放特效
         warningEffect->SetDuration(m_Delay + 1.0f);
         warningEffect->Play(m_Position, m_ZIndex - 2.0f);
 
-        m_WarningEffect = warningEffect;
+        m_WarningEffect = std::move(lease);
         // LOG_DEBUG("Circle warning effect created and played");
     } catch (const std::exception& e) {
         LOG_ERROR("Exception in CreateWarningEffect: {}", e.what());
@@ -50,26 +41,22 @@ void CircleAttack::CreateWarningEffect() {
 // 修改 CircleAttack.cpp 中的 CreateAttackEffect 方法來確保移動參數正確應用
 void CircleAttack::CreateAttackEffect() {
     try {
-        // 獲取圓形攻擊特效
-        auto circleEffect = Effect::EffectManager::GetInstance().GetEffect(Effect::EffectType::ENEMY_ATTACK_2);
-
-        // 配置特效參數
-        if (auto circleShape = std::dynamic_pointer_cast<Effect::Shape::CircleShape>(circleEffect->GetBaseShape())) {
-            // 調整為適合半徑的相對尺寸
-            float normalizedRadius = 0.35f;
-            circleShape->SetRadius(normalizedRadius);
-
-            // 設置視覺大小以匹配實際半徑
+        // 獲取圓形攻擊特效：移動中的彈幕使用帶尾跡的 circle_bullet
+        static const auto& library = Effect::EffectLibrary::GetInstance();
+        static const Effect::PrototypeId kAttack = library.Find("circle_attack", Effect::EffectType::ENEMY_ATTACK_2);
+        static const Effect::PrototypeId kBullet = library.Find("circle_bullet", Effect::EffectType::ENEMY_ATTACK_2);
+        auto& effects = Effect::EffectManager::GetInstance();
+        auto lease = effects.LeaseEffect(m_IsMoving ? kBullet : kAttack);
+        auto circleEffect = lease.Get();
+
+        // 設置視覺大小以匹配實際半徑
+        if (auto circleShape = circleEffect->GetShape<Effect::Shape::CircleShape>()) {
             float visualSize = m_Radius * 2.5f;
             circleShape->SetSize({visualSize, visualSize});
-
-            // 設置顏色
-            circleShape->SetColor(m_Color);
         }
 
-        // 設置填充與邊緣效果
-        circleEffect->SetFillModifier(Effect::Modifier::FillModifier(Effect::Modifier::FillType::SOLID));
-        circleEffect->SetEdgeModifier(Effect::Modifier::EdgeModifier(Effect::Modifier::EdgeType::GLOW, 0.05, Util::Color(1.0, 0.0, 0.0, 0.7)));
+        // 設置顏色
+        circleEffect->SetColor(m_Color);
 
         // 如果設置了移動，那麼添加移動修飾器
         if (m_IsMoving) {
@@ -98,7 +85,7 @@ void CircleAttack::CreateAttackEffect() {
         // LOG_DEBUG("Circle attack effect created at ({}, {}) with duration: {}",
         //           m_Position.x, m_Position.y, m_AttackDuration);
 
-        m_AttackEffect = circleEffect;
+        m_AttackEffect = std::move(lease);
     } catch (const std::exception& e) {
         LOG_ERROR("Exception in CreateAttackEffect: {}", e.what());
     }
@@ -113,9 +100,10 @@ bool CircleAttack::CheckCollisionInternal(const std::shared_ptr<Character>& char
 
 void CircleAttack::SyncWithEffect() {
     // 檢查攻擊特效是否存在且處於活躍狀態
-    if (m_AttackEffect && m_AttackEffect->IsActive()) {
+    auto attackEffect = m_AttackEffect.Get();
+    if (attackEffect && attackEffect->IsActive()) {
         // 獲取特效當前位置
-        glm::vec2 effectPosition = m_AttackEffect->GetPosition();
+        glm::vec2 effectPosition = attackEffect->GetPosition();
 
         // 更新攻擊的位置，用於碰撞檢測
         m_Position = effectPosition;
@@ -176,6 +164,14 @@ void CircleAttack::OnAttackStart() {
     }
 }
 
+void CircleAttack::OnAttackUpdate(float deltaTime) {
+    // 移動的彈幕飛完，或飛出場地被特效管理器提早回收後，不再從目前位置重新發射
+    if (m_IsMoving && m_AttackEffect.IsExpired()) {
+        return;
+    }
+    Attack::OnAttackUpdate(deltaTime);
+}
+
 void CircleAttack::CleanupVisuals() {
     Attack::CleanupVisuals();
     if (m_DirectionIndicator) {
@@ -54,7 +54,7 @@ void CornerBulletAttack::AddBulletPath(const glm::vec2& startPosition, float ang
     path.startPosition = startPosition;
     path.currentPosition = startPosition;
     path.angle = angle;
-    m_BulletPaths.push_back(path);
+    m_BulletPaths.push_back(std::move(path));
 }
 
 void CornerBulletAttack::CreateWarningEffect() {
@@ -88,31 +88,30 @@ void CornerBulletAttack::CreateWarningEffect() {
         AddBulletPath(bottomLeft, angle);
     }
 
-    for (auto& path : m_BulletPaths) {
-        // 計算彈道終點
-        float distance = 3000.0f;
-        glm::vec2 endPosition = path.startPosition +
-            glm::vec2(cos(path.angle), sin(path.angle)) * distance;
-
-        // 長度和旋轉角度
-        float length = glm::distance(path.startPosition, endPosition);
-        float width = GetRadius() * 2.0f;
-
-        // 創建矩形警告效果
-        auto warningEffect = Effect::EffectManager::GetInstance().GetEffect(Effect::EffectType::RECT_BEAM);
-        if (auto rectangleShape = std::dynamic_pointer_cast<Effect::Shape::RectangleShape>(warningEffect->GetBaseShape())) {
-            rectangleShape->SetDimensions(glm::vec2(1.0f, width / length));
-            rectangleShape->SetRotation(path.angle);
-            rectangleShape->SetSize({length, length});
-            rectangleShape->SetColor(Util::Color(1.0f, 0.0f, 0.0f, 0.2f));
-            rectangleShape->SetAutoRotation(false);
-        }
-        warningEffect->SetFillModifier(Effect::Modifier::FillModifier(Effect::Modifier::FillType::SOLID));
-        warningEffect->SetEdgeModifier(Effect::Modifier::EdgeModifier(Effect::Modifier::EdgeType::GLOW, 0.01, Util::Color(0.9, 0.1, 0.1, 0.5)));
-        warningEffect->SetDuration(m_Delay + 0.5f);
+    // 所有彈道的矩形警告效果一次生成 (顏色與修飾器定義在 effects.def 的 bullet_path_warning)
+    static const Effect::PrototypeId kPathWarning =
+        Effect::EffectLibrary::GetInstance().Find("bullet_path_warning", Effect::EffectType::RECT_BEAM);
+    const float length = 3000.0f;   // 彈道長度
+    const float width = GetRadius() * 2.0f;
+
+    m_WarningSpawns.clear();
+    for (const auto& path : m_BulletPaths) {
+        Effect::EffectManager::Spawn spawn;
+        spawn.prototype = kPathWarning;
+        spawn.position = path.startPosition;
+        spawn.zIndex = m_ZIndex - 1.0f;
+        spawn.rotation = path.angle;
+        spawn.dimensions = glm::vec2(1.0f, width / length);
+        spawn.size = glm::vec2(length, length);
+        spawn.duration = m_Delay + 0.5f;
+        m_WarningSpawns.push_back(spawn);
+    }
 
-        warningEffect->Play(path.startPosition, m_ZIndex - 1.0f);
-        path.warningEffect = warningEffect;
+    m_WarningHandles.resize(m_WarningSpawns.size());
+    Effect::EffectManager::GetInstance().PlayEffects(m_WarningSpawns.data(), m_WarningSpawns.size(),
+                                                     m_WarningHandles.data());
+    for (size_t i = 0; i < m_BulletPaths.size(); ++i) {
+        m_BulletPaths[i].warningEffect = Effect::EffectLease(m_WarningHandles[i]);
     }
 }
 
@@ -146,17 +145,13 @@ void CornerBulletAttack::CreateAttackEffect() {
 void CornerBulletAttack::OnAttackStart() {
     CreateAttackEffect();
     for (auto& path : m_BulletPaths) {
-        if (path.warningEffect) {
-            path.warningEffect->Reset();
-        }
+        path.warningEffect.Release();
     }
 }
 
 void CornerBulletAttack::CleanupVisuals() {
     CircleAttack::CleanupVisuals();
     for (auto& path : m_BulletPaths) {
-        if (path.warningEffect) {
-            path.warningEffect->Reset();
-        }
+        path.warningEffect.Release();
     }
 }
\ No newline at end of file
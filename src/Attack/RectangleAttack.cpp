@@ -31,8 +31,8 @@ RectangleAttack::RectangleAttack(const glm::vec2& position, float delay, Directi
 void RectangleAttack::SetRotation(float rotation) {
     m_Rotation = rotation;
 
-    if (m_AttackEffect) {
-        if (auto rectangleShape = std::dynamic_pointer_cast<Effect::Shape::RectangleShape>(m_AttackEffect->GetBaseShape())) {
+    if (auto attackEffect = m_AttackEffect.Get()) {
+        if (auto rectangleShape = attackEffect->GetShape<Effect::Shape::RectangleShape>()) {
             rectangleShape->SetRotation(rotation);
         }
     }
@@ -43,11 +43,16 @@ void RectangleAttack::CreateWarningEffect() {
     //          m_Position.x, m_Position.y, m_Width, m_Height, m_Rotation);
 
     try {
-        auto warningEffect = Effect::EffectManager::GetInstance().GetEffect(Effect::EffectType::RECT_BEAM);
+        // 顏色、修飾器與關閉自動旋轉定義在 effects.def 的 rect_warning
+        static const Effect::PrototypeId kWarning =
+            Effect::EffectLibrary::GetInstance().Find("rect_warning", Effect::EffectType::RECT_BEAM);
+        auto& effects = Effect::EffectManager::GetInstance();
+        auto lease = effects.LeaseEffect(kWarning);
+        auto warningEffect = lease.Get();
         if (!warningEffect) return;
 
         // 特效參數
-        if (auto rectangleShape = std::dynamic_pointer_cast<Effect::Shape::RectangleShape>(warningEffect->GetBaseShape())) {
+        if (auto rectangleShape = warningEffect->GetShape<Effect::Shape::RectangleShape>()) {
             // 計算歸一化的尺寸比例
             float maxDimension = std::max(m_Width, m_Height);
             float normalizedWidth = m_Width / maxDimension;
@@ -55,32 +60,17 @@ void RectangleAttack::CreateWarningEffect() {
 
             rectangleShape->SetDimensions({normalizedWidth, normalizedHeight});
             rectangleShape->SetRotation(m_Rotation);
-
-            // 禁用旋轉
-            rectangleShape->SetAutoRotation(false);
             rectangleShape->SetSize({maxDimension * 1.2f, maxDimension * 1.2f});
-            rectangleShape->SetColor(Util::Color(0.9, 0.1, 0.1, 0.5));
 
             // LOG_DEBUG("Rectangle warning effect shape configured");
         } else {
             LOG_ERROR("Failed to cast to RectangleShape");
         }
 
-        // 設置填充與邊緣效果
-        warningEffect->SetFillModifier(Effect::Modifier::FillModifier(Effect::Modifier::FillType::SOLID));
-        warningEffect->SetEdgeModifier(Effect::Modifier::EdgeModifier(Effect::Modifier::EdgeType::GLOW, 0.001, Util::Color(0.9, 0.1, 0.1, 0.7)));
-
-        // 關閉任何動畫
-        warningEffect->SetAnimationModifier(Effect::Modifier::AnimationModifier(
-            Effect::Modifier::AnimationType::NONE,
-            0.0f,
-            0.0f
-        ));
-
         warningEffect->SetDuration(m_Delay + 1.0f);  // 確保持續足夠長的時間
         warningEffect->Play(m_Position, z_ind);
 
-        m_WarningEffect = warningEffect;
+        m_WarningEffect = std::move(lease);
         // LOG_DEBUG("Rectangle warning effect created and played");
     } catch (const std::exception& e) {
         LOG_ERROR("Exception in CreateWarningEffect: {}", e.what());
@@ -91,9 +81,14 @@ void RectangleAttack::CreateAttackEffect() {
     // LOG_DEBUG("RectangleAttack::CreateAttackEffect called with duration: {}", m_AttackDuration);
 
     try {
-        auto rectangleEffect = Effect::EffectManager::GetInstance().GetEffect(Effect::EffectType::RECT_LASER);
-
-        if (auto rectangleShape = std::dynamic_pointer_cast<Effect::Shape::RectangleShape>(rectangleEffect->GetBaseShape())) {
+        // 顏色與修飾器定義在 effects.def 的 rect_attack
+        static const Effect::PrototypeId kAttack =
+            Effect::EffectLibrary::GetInstance().Find("rect_attack", Effect::EffectType::RECT_LASER);
+        auto& effects = Effect::EffectManager::GetInstance();
+        auto lease = effects.LeaseEffect(kAttack);
+        auto rectangleEffect = lease.Get();
+
+        if (auto rectangleShape = rectangleEffect->GetShape<Effect::Shape::RectangleShape>()) {
             // 計算歸一化的尺寸比例
             float maxDimension = std::max(m_Width, m_Height);
             float normalizedWidth = m_Width / maxDimension;
@@ -105,26 +100,14 @@ void RectangleAttack::CreateAttackEffect() {
             rectangleShape->SetAutoRotation(m_AutoRotate, m_RotationSpeed);
 
             rectangleShape->SetSize({maxDimension * 1.2f, maxDimension * 1.2f});
-            rectangleShape->SetColor(Util::Color(0.9, 0.7, 0.3, 0.4));
         }
 
-        // 設置填充與邊緣效果
-        rectangleEffect->SetFillModifier(Effect::Modifier::FillModifier(Effect::Modifier::FillType::SOLID));
-        // rectangleEffect->SetEdgeModifier(Effect::Modifier::EdgeModifier(Effect::Modifier::EdgeType::GLOW, 0.001, Util::Color(0.9, 0.1, 0.1, 0.7)));
-
-        // 關閉任何動畫
-        rectangleEffect->SetAnimationModifier(Effect::Modifier::AnimationModifier(
-            Effect::Modifier::AnimationType::NONE,
-            0.0f,
-            0.0f
-        ));
-
         // 使用較大值來確保特效持續整個攻擊階段
         float effectDuration = m_AttackDuration * 1.5f;
         rectangleEffect->SetDuration(effectDuration);
 
         rectangleEffect->Play(m_Position, z_ind + 1.0f);
-        m_AttackEffect = rectangleEffect;
+        m_AttackEffect = std::move(lease);
     } catch (const std::exception& e) {
         LOG_ERROR("Exception in CreateAttackEffect: {}", e.what());
     }
@@ -198,9 +181,10 @@ bool RectangleAttack::IsPointInPolygon(const glm::vec2& point, const glm::vec2*
 
 void RectangleAttack::SyncWithEffect() {
     // 檢查攻擊特效是否存在且處於活躍狀態
-    if (m_AttackEffect && m_AttackEffect->IsActive()) {
+    auto attackEffect = m_AttackEffect.Get();
+    if (attackEffect && attackEffect->IsActive()) {
         // 嘗試獲取矩形形狀
-        auto rectangleShape = std::dynamic_pointer_cast<Effect::Shape::RectangleShape>(m_AttackEffect->GetBaseShape());
+        const auto* rectangleShape = attackEffect->GetShape<Effect::Shape::RectangleShape>();
         if (rectangleShape) {
             // 從特效獲取當前旋轉角度
             float currentRotation = rectangleShape->GetRotation();
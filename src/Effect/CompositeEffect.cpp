@@ -3,116 +3,117 @@
 #include "Util/Logger.hpp"
 
 namespace Effect {
-    CompositeEffect::CompositeEffect(const std::shared_ptr<Shape::BaseShape>& baseShape)
-        : m_BaseShape(baseShape) {
+    CompositeEffect::CompositeEffect(const ShapeVariant& shape, float duration)
+        : m_Shape(shape), m_Duration(duration) {
+    }
 
-        if (!baseShape) {
-            LOG_ERROR("CompositeEffect created with null baseShape");
-        }
+    void CompositeEffect::WriteInstance(EffectInstance& instance) const {
+        const glm::vec2 size = GetSize();
+        instance.transform = glm::vec4(m_Transform.translation, size);
+        instance.params = glm::vec4(m_Transform.rotation, m_ZIndex, m_ElapsedTime,
+                                    static_cast<float>(GetShapeClass()));
+        instance.color = glm::vec4(m_Color.r, m_Color.g, m_Color.b, m_Color.a);
+
+        std::visit([&instance](const auto& shape) { shape.WriteInstance(instance); }, m_Shape);
+        m_FillModifier.Apply(instance);
+        m_EdgeModifier.Apply(instance);
+        m_AnimationModifier.Apply(instance);
+        m_MovementModifier.Apply(instance);
     }
 
-    void CompositeEffect::Draw(const Core::Matrices& data) {
-        if (m_State != State::ACTIVE || !m_BaseShape) return;
-        Core::Program* program = nullptr;
-
-        if (auto circleShape = dynamic_cast<Shape::CircleShape*>(m_BaseShape.get())) {
-            (void) circleShape;
-            program = Shape::CircleShape::GetProgram();
-        } else if (auto ellipseShape = dynamic_cast<Shape::EllipseShape*>(m_BaseShape.get())) {
-            (void) ellipseShape;
-            program = Shape::EllipseShape::GetProgram();
-        } else if (auto rectangleShape = dynamic_cast<Shape::RectangleShape*>(m_BaseShape.get())) {
-            (void) rectangleShape;
-            program = Shape::RectangleShape::GetProgram();
+    glm::vec2 CompositeEffect::GetPosition() const {
+        // 移動中的特效只有起點存在 m_Transform，目前位置依播放時間計算
+        if (m_MovementModifier.IsMoving() && m_State != State::INACTIVE) {
+            return m_MovementModifier.Evaluate(m_ElapsedTime);
         }
+        return m_Transform.translation;
+    }
 
-        if (!program) {
-            LOG_ERROR("Failed to get program for CompositeEffect - BaseShape type not recognized");
-            return;
+    float CompositeEffect::GetTrailWidth() const {
+        const glm::vec2 size = GetSize();
+        // 形狀的半徑與寬高是相對畫布的比例
+        if (const auto* circle = std::get_if<Shape::CircleShape>(&m_Shape)) {
+            return 2.0f * circle->GetRadius() * std::min(size.x, size.y);
         }
+        return 0.5f * std::min(size.x, size.y);
+    }
 
-        // 先綁定程序，這樣才能設置 uniform
-        program->Bind();
-
-        // 依次應用修飾器
-        m_FillModifier.Apply(*program);
-        m_EdgeModifier.Apply(*program);
-        m_AnimationModifier.Apply(*program, m_ElapsedTime);
+    float CompositeEffect::GetBoundingRadius() const {
+        const glm::vec2 size = GetSize();
+        // 圓與橢圓的邊緣、反鋸齒與波紋都往形狀外多畫一點 (相對畫布的比例，與 Effect.vert 的 ringMargin 相同)
+        float margin = m_EdgeModifier.GetWidth() + 0.01f;
+        if (m_AnimationModifier.GetAnimationType() == Modifier::AnimationType::RIPPLE) {
+            margin += std::abs(m_AnimationModifier.GetIntensity()) * 0.1f;
+        }
 
-        // 設置時間 uniform - 確保基本的時間變量存在於所有著色器中
-        GLint timeLocation = glGetUniformLocation(program->GetId(), "u_Time");
-        if (timeLocation != -1) {
-            glUniform1f(timeLocation, m_ElapsedTime);
+        // 畫出來的四邊形不會超過畫布 (矩形另外只畫包住長條的四邊形)
+        float radius = 0.5f * glm::length(size);
+        if (const auto* circle = std::get_if<Shape::CircleShape>(&m_Shape)) {
+            radius = std::min(radius, (circle->GetRadius() + margin) * std::max(size.x, size.y));
+        } else if (const auto* ellipse = std::get_if<Shape::EllipseShape>(&m_Shape)) {
+            const glm::vec2 radii = (ellipse->GetRadii() + glm::vec2(margin)) * size;
+            radius = std::min(radius, std::max(radii.x, radii.y));
+        } else if (const auto* rectangle = std::get_if<Shape::RectangleShape>(&m_Shape)) {
+            const glm::vec2 extent = (rectangle->GetDimensions() + glm::vec2(2.0f * m_EdgeModifier.GetWidth())) * size;
+            radius = 0.5f * glm::length(extent);
         }
+        return radius;
+    }
 
-        // 驗證著色器程序以確保所有 uniform 都已設置正確
-        program->Validate();
+    glm::vec2 CompositeEffect::GetVelocity() const {
+        if (!m_MovementModifier.IsMoving() || m_MovementModifier.HasReachedDestination(m_ElapsedTime)) {
+            return glm::vec2(0.0f);
+        }
+        return m_MovementModifier.GetVelocity();
+    }
 
-        // 繪製基本形狀
-        m_BaseShape->Draw(data);
+    bool CompositeEffect::IsBakeable() const {
+        // 會移動、會轉或有動畫的外觀每幀都不同，只能畫 SDF
+        if (!m_Bakeable || m_MovementModifier.IsMoving()) return false;
+        if (m_AnimationModifier.GetAnimationType() != Modifier::AnimationType::NONE) return false;
+        const auto* rectangle = std::get_if<Shape::RectangleShape>(&m_Shape);
+        return !rectangle || !rectangle->IsAutoRotating();
     }
 
     glm::vec2 CompositeEffect::GetSize() const {
-        return m_BaseShape ? m_BaseShape->GetSize() : glm::vec2(0.0f);
+        return std::visit([](const auto& shape) { return shape.GetSize(); }, m_Shape);
+    }
+
+    void CompositeEffect::SetSize(const glm::vec2& size) {
+        std::visit([&size](auto& shape) { shape.SetSize(size); }, m_Shape);
     }
 
     void CompositeEffect::Update(float deltaTime) {
         if (m_State != State::ACTIVE) return;
 
-        // Update base shape
-        m_BaseShape->Update(deltaTime);
-
-        // Apply movement modifier
-        if (m_MovementModifier.IsMoving()) {
-            glm::vec2 position = m_Transform.translation;
-            m_MovementModifier.Update(deltaTime, position);
-            m_Transform.translation = position;
-
-            // If reached destination and base shape is still active, end the effect
-            if (m_MovementModifier.HasReachedDestination() && m_BaseShape->GetState() == State::ACTIVE) {
-                m_BaseShape->Reset();
-                m_State = State::FINISHED;
-            }
-        }
-
-        // Sync state
-        if (m_BaseShape->GetState() == State::FINISHED) {
-            m_State = State::FINISHED;
+        // 形狀本身的動畫 (目前只有矩形的自動旋轉)
+        if (auto* rectangle = std::get_if<Shape::RectangleShape>(&m_Shape)) {
+            rectangle->Update(deltaTime);
         }
 
         // Update time
         m_ElapsedTime += deltaTime;
-        if (m_ElapsedTime >= m_Duration) {
+
+        // Movement is closed form in the elapsed time and evaluated by the vertex
+        // shader; here we only need to know when the destination is reached
+        if (m_MovementModifier.HasReachedDestination(m_ElapsedTime) || m_ElapsedTime >= m_Duration) {
             m_State = State::FINISHED;
         }
     }
 
     void CompositeEffect::Play(const glm::vec2& position, float zIndex) {
-        if (!m_BaseShape) return;
         Reset();
         m_Transform.translation = position;
         m_ZIndex = zIndex;
         m_State = State::ACTIVE;
 
-        // Sync position to base shape
-
-        m_BaseShape->Play(position, zIndex);
-
-        // Reset movement modifier and set start position
-        if (m_MovementModifier.IsMoving()) {
-            m_MovementModifier.Reset();
-            m_MovementModifier.SetSpeed(m_MovementModifier.GetSpeed() * m_direction);
-            m_MovementModifier.SetStartPosition(position);
-        }
+        // Record where the straight-line motion starts
+        m_MovementModifier.Start(position, m_direction);
     }
 
     void CompositeEffect::Reset() {
-        if (m_BaseShape) {
-            m_BaseShape->Reset();
-        }
-
         m_ElapsedTime = 0.0f;
         m_State = State::INACTIVE;
     }
 
-} // namespace Effect
\ No newline at end of file
+} // namespace Effect
@@ -0,0 +1,600 @@
+#include "Effect/EffectBatchRenderer.hpp"
+#include "Render/RenderState.hpp"
+#include "Util/Logger.hpp"
+#include "Util/TransformUtils.hpp"
+#include "config.hpp"
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace Effect {
+
+    namespace {
+        // 實例屬性從 location 2 開始 (0, 1 為四邊形的位置與 UV)
+        constexpr GLuint kFirstInstanceAttribute = 2;
+        constexpr GLuint kInstanceAttributeCount = sizeof(EffectInstance) / sizeof(glm::vec4);
+
+        // 串流緩衝區每段的初始容量 (以實例數計)，不夠時會加倍
+        constexpr size_t kInitialInstanceCapacity = 64;
+
+        // 環的分段數 (對應 Geometry::RING_16 起的各個網格)
+        constexpr std::array<unsigned int, 4> kRingSegments = {16, 32, 64, 128};
+
+        // 環的外圈是外接多邊形，頂點比圓多出去的距離 (像素) 超過這個值就換分段更多的環
+        constexpr float kMaxRingOvershoot = 1.5f;
+
+        // 依外圈在畫面上的半徑 (像素) 選環的分段數
+        size_t SelectRingLevel(float radius) {
+            for (size_t i = 0; i + 1 < kRingSegments.size(); ++i) {
+                const float overshoot = radius * (1.0f / std::cos(static_cast<float>(M_PI) / kRingSegments[i]) - 1.0f);
+                if (overshoot <= kMaxRingOvershoot) return i;
+            }
+            return kRingSegments.size() - 1;
+        }
+
+        // 把實例屬性指向 buffer 中的 offset (GL 4.1 沒有 base instance，只能重設指標)
+        void PointInstanceAttributes(size_t offset) {
+            for (GLuint i = 0; i < kInstanceAttributeCount; ++i) {
+                glVertexAttribPointer(
+                    kFirstInstanceAttribute + i, 4, GL_FLOAT, GL_FALSE, sizeof(EffectInstance),
+                    reinterpret_cast<const void*>(offset + i * sizeof(glm::vec4)));
+            }
+        }
+
+        // 實例緩衝區掛到 VAO 上，每個實例前進一次
+        void AttachInstanceStream(const Core::VertexArray& vertexArray, GLuint buffer) {
+            vertexArray.Bind();
+            glBindBuffer(GL_ARRAY_BUFFER, buffer);
+            for (GLuint i = 0; i < kInstanceAttributeCount; ++i) {
+                glEnableVertexAttribArray(kFirstInstanceAttribute + i);
+                glVertexAttribDivisor(kFirstInstanceAttribute + i, 1);
+            }
+            PointInstanceAttributes(0);
+            vertexArray.Unbind();
+        }
+
+        // 外觀編號：實例資料 (已去掉位置、z 與時間) 加上變體編號的 FNV-1a 雜湊
+        uint64_t HashLook(const EffectInstance& look, uint16_t variantKey) {
+            uint64_t hash = 14695981039346656037ull;
+            auto mix = [&hash](const void* data, size_t size) {
+                const auto* bytes = static_cast<const unsigned char*>(data);
+                for (size_t i = 0; i < size; ++i) {
+                    hash ^= bytes[i];
+                    hash *= 1099511628211ull;
+                }
+            };
+            mix(&look, sizeof(look));
+            mix(&variantKey, sizeof(variantKey));
+            return hash;
+        }
+    }
+
+    EffectBatchRenderer::EffectBatchRenderer() {
+        InitializeResources();
+    }
+
+    EffectBatchRenderer::~EffectBatchRenderer() {
+        if (m_BakeBuffer != 0) glDeleteBuffers(1, &m_BakeBuffer);
+    }
+
+    void EffectBatchRenderer::InitializeResources() {
+        // 只讀入原始碼，各變體在 Prepare 或第一次繪製時編譯
+        m_Shaders = std::make_unique<Render::ShaderPermutations>(
+            GA_RESOURCE_DIR "/shaders/Effect.vert",
+            GA_RESOURCE_DIR "/shaders/Effect.frag");
+
+        // 與各形狀相同的單位四邊形
+        m_VertexArray = std::make_unique<Core::VertexArray>();
+        m_VertexArray->AddVertexBuffer(std::make_unique<Core::VertexBuffer>(
+            std::vector<float>{
+                -0.5f, 0.5f,   // top left
+                -0.5f, -0.5f,  // bottom left
+                0.5f, -0.5f,   // bottom right
+                0.5f, 0.5f     // top right
+            },
+            2));
+        m_VertexArray->AddVertexBuffer(std::make_unique<Core::VertexBuffer>(
+            std::vector<float>{
+                0.0f, 0.0f,  // top left
+                0.0f, 1.0f,  // bottom left
+                1.0f, 1.0f,  // bottom right
+                1.0f, 0.0f   // top right
+            },
+            2));
+        m_VertexArray->SetIndexBuffer(std::make_unique<Core::IndexBuffer>(
+            std::vector<unsigned int>{
+                0, 1, 2,
+                0, 2, 3
+            }));
+
+        m_Meshes[static_cast<size_t>(Geometry::QUAD)] = MeshRange{6, 0};
+        InitializeOutlineMeshes();
+
+        // 兩個 VAO 共用同一個實例串流
+        m_InstanceStream = std::make_unique<Render::StreamBuffer>(
+            GL_ARRAY_BUFFER, kInitialInstanceCapacity * sizeof(EffectInstance), sizeof(EffectInstance));
+        AttachInstanceStream(*m_VertexArray, m_InstanceStream->GetId());
+        AttachInstanceStream(*m_OutlineArray, m_InstanceStream->GetId());
+
+        // 投影矩陣只跟視窗大小有關，取一次即可
+        m_Projection = Util::ConvertToUniformBufferData(Util::Transform{}, {1.0f, 1.0f}, 0.0f).m_Projection;
+
+        // 烘焙外觀的貼圖程式；載入失敗時靜態特效照常畫 SDF
+        try {
+            m_SpriteProgram = std::make_unique<Render::ShaderProgram>(
+                GA_RESOURCE_DIR "/shaders/Telegraph.vert",
+                GA_RESOURCE_DIR "/shaders/Telegraph.frag");
+            m_SpriteUniforms = std::make_unique<Render::UniformTable>(m_SpriteProgram->GetId());
+            m_SpriteProjection = m_SpriteUniforms->Find("u_Projection");
+            m_SpriteAtlas = m_SpriteUniforms->Find("u_Atlas");
+
+            // 預警遮罩用：同一份原始碼，只輸出覆蓋率
+            m_CoverageProgram = std::make_unique<Render::ShaderProgram>(
+                Render::ShaderSource::FromFile(GA_RESOURCE_DIR "/shaders/Telegraph.vert"),
+                Render::ShaderSource::FromFile(GA_RESOURCE_DIR "/shaders/Telegraph.frag"),
+                "#define COVERAGE_OUTPUT 1\n");
+            m_CoverageUniforms = std::make_unique<Render::UniformTable>(m_CoverageProgram->GetId());
+            m_CoverageProjection = m_CoverageUniforms->Find("u_Projection");
+            m_CoverageAtlas = m_CoverageUniforms->Find("u_Atlas");
+        } catch (const std::exception& e) {
+            LOG_ERROR("Failed to load telegraph shaders: {}", e.what());
+            m_SpriteProgram.reset();
+            m_CoverageProgram.reset();
+        }
+        m_Meshes[static_cast<size_t>(Geometry::SPRITE)] = MeshRange{6, 0};
+
+        glGenBuffers(1, &m_BakeBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, m_BakeBuffer);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(EffectInstance), nullptr, GL_DYNAMIC_DRAW);
+        m_AtlasProjection = glm::ortho(0.0f, static_cast<float>(kAtlasSize), 0.0f, static_cast<float>(kAtlasSize),
+                                       -1.0f, 1.0f);
+    }
+
+    void EffectBatchRenderer::InitializeOutlineMeshes() {
+        // 頂點：location 0 為方向 (環) 或角落符號 (框)，location 1 的 x 為 0=內圈、1=外圈，
+        // 實際的內外半徑由頂點著色器依實例參數決定 (見 Effect.vert 的 canvasCoord)
+        std::vector<float> positions;
+        std::vector<float> rings;
+        std::vector<unsigned int> indices;
+
+        // 一圈 count 對內外頂點，相鄰兩對組成兩個三角形
+        auto addLoop = [&](Geometry geometry, size_t count, const auto& direction, float outerScale) {
+            const auto base = static_cast<unsigned int>(positions.size() / 2);
+            for (size_t k = 0; k < count; ++k) {
+                const glm::vec2 dir = direction(k);
+                positions.insert(positions.end(), {dir.x, dir.y, dir.x * outerScale, dir.y * outerScale});
+                rings.insert(rings.end(), {0.0f, 0.0f, 1.0f, 0.0f});
+            }
+            m_Meshes[static_cast<size_t>(geometry)] = MeshRange{static_cast<GLsizei>(count * 6), indices.size()};
+            for (size_t k = 0; k < count; ++k) {
+                const auto inner0 = base + static_cast<unsigned int>(2 * k);
+                const auto inner1 = base + static_cast<unsigned int>(2 * ((k + 1) % count));
+                indices.insert(indices.end(), {inner0, inner1, inner1 + 1, inner0, inner1 + 1, inner0 + 1});
+            }
+        };
+
+        // 空心矩形的框：四個角落
+        constexpr std::array<glm::vec2, 4> kCorners = {
+            glm::vec2(-1.0f, -1.0f), glm::vec2(1.0f, -1.0f), glm::vec2(1.0f, 1.0f), glm::vec2(-1.0f, 1.0f)};
+        addLoop(Geometry::FRAME, kCorners.size(), [&](size_t k) { return kCorners[k]; }, 1.0f);
+
+        // 環：外圈放大成外接多邊形，整個圓都在網格內
+        for (size_t level = 0; level < kRingSegments.size(); ++level) {
+            const unsigned int segments = kRingSegments[level];
+            const float step = 2.0f * static_cast<float>(M_PI) / static_cast<float>(segments);
+            addLoop(static_cast<Geometry>(static_cast<size_t>(Geometry::RING_16) + level), segments,
+                    [step](size_t k) { return glm::vec2(std::cos(step * k), std::sin(step * k)); },
+                    1.0f / std::cos(0.5f * step));
+        }
+
+        m_OutlineArray = std::make_unique<Core::VertexArray>();
+        m_OutlineArray->AddVertexBuffer(std::make_unique<Core::VertexBuffer>(positions, 2));
+        m_OutlineArray->AddVertexBuffer(std::make_unique<Core::VertexBuffer>(rings, 2));
+        m_OutlineArray->SetIndexBuffer(std::make_unique<Core::IndexBuffer>(indices));
+    }
+
+    EffectBatchRenderer::Geometry EffectBatchRenderer::SelectGeometry(const EffectInstance& instance,
+                                                                      const ShaderVariant& variant) const {
+        if (variant.fill != Modifier::FillType::HOLLOW) return Geometry::QUAD;
+        if (variant.shape == ShapeClass::RECTANGLE) return Geometry::FRAME;
+
+        // 外圈在畫面上的半徑 (像素)；畫在降解析度圖層時以圖層的像素計
+        const float width = instance.transform.z;
+        const float height = instance.transform.w;
+        const float radius = variant.shape == ShapeClass::CIRCLE
+            ? instance.shape.x * std::max(width, height)
+            : std::max(instance.shape.x * width, instance.shape.y * height);
+        const float scale = m_LayerActive ? GetEffectiveLayerScale() : 1.0f;
+        return static_cast<Geometry>(static_cast<size_t>(Geometry::RING_16) + SelectRingLevel(radius * scale));
+    }
+
+    const EffectBatchRenderer::VariantProgram* EffectBatchRenderer::GetProgram(uint16_t key) {
+        if (key >= m_Programs.size()) return nullptr;
+
+        VariantProgram& variant = m_Programs[key];
+        if (variant.program == 0) {
+            if (m_Shaders->Has(key)) return nullptr;  // 編譯過但失敗
+
+            variant.program = m_Shaders->Get(key, ShaderVariant::FromKey(key).GetDefines());
+            if (variant.program == 0) return nullptr;
+            variant.uniforms = std::make_unique<Render::UniformTable>(variant.program);
+            variant.projection = variant.uniforms->Find("u_Projection");
+        }
+        return &variant;
+    }
+
+    bool EffectBatchRenderer::UseBatchProgram(uint16_t key) {
+        auto& state = Render::RenderState::GetInstance();
+        if (static_cast<Geometry>(key >> kVariantBits) == Geometry::SPRITE) {
+            state.UseProgram(*m_SpriteProgram);
+            m_SpriteUniforms->Set(m_SpriteProjection, m_Projection);
+            m_SpriteUniforms->Set(m_SpriteAtlas, 0);
+            state.BindTexture(m_Atlas->GetTexture(), 0);
+            return true;
+        }
+
+        const VariantProgram* variant = GetProgram(key & kVariantMask);
+        if (!variant) return false;
+        state.UseProgram(variant->program);
+        variant->uniforms->Set(variant->projection, m_Projection);
+        return true;
+    }
+
+    void EffectBatchRenderer::Prepare(const ShaderVariant& variant) {
+        if (variant.edge != Modifier::EdgeType::GLOW) {
+            GetProgram(variant.GetKey());
+            return;
+        }
+        // 發光邊緣：BLOOM_BASE 在關閉發光時也會用到
+        GetProgram(variant.WithGlowPass(GlowPass::BLOOM_BASE).GetKey());
+        GetProgram(variant.WithGlowPass(m_BloomEnabled ? GlowPass::EMISSIVE : GlowPass::DIRECT).GetKey());
+    }
+
+    void EffectBatchRenderer::SetBloomEnabled(bool enabled) {
+        if (enabled && !m_Bloom) {
+            m_Bloom = std::make_unique<Render::BloomPass>();
+        }
+        m_BloomEnabled = enabled;
+    }
+
+    void EffectBatchRenderer::Begin() {
+        m_Instances.clear();
+        m_InstanceBatches.clear();
+        m_EmissiveInstances.clear();
+        m_EmissiveBatches.clear();
+        m_MaxZ = std::numeric_limits<float>::lowest();
+        m_EmissiveMaxZ = std::numeric_limits<float>::lowest();
+
+        const float layerScale = GetEffectiveLayerScale();
+        if (layerScale < 1.0f && !m_Layer) {
+            m_Layer = std::make_unique<Render::ScaledLayer>();
+        }
+        m_LayerActive = layerScale < 1.0f && m_Layer->IsValid();
+        if (m_LayerActive) {
+            m_Layer->BeginFrame(layerScale);
+        }
+
+        if (m_Atlas) {
+            m_Atlas->BeginFrame();
+        }
+
+        m_MaskInstances.clear();
+        m_MaskMaxZ = std::numeric_limits<float>::lowest();
+        if (m_TelegraphMaskEnabled && !m_Mask) {
+            m_Mask = std::make_unique<Render::CoverageMask>();
+        }
+        m_MaskActive = m_TelegraphMaskEnabled && m_Mask->IsValid() && m_CoverageProgram;
+        if (m_MaskActive) {
+            m_Mask->BeginFrame(kTelegraphMaskScale);
+        }
+
+        m_StreamBegun = false;
+        m_DrawCallCount = 0;
+        m_InstanceCount = 0;
+        m_BakeCount = 0;
+    }
+
+    void EffectBatchRenderer::Submit(const EffectInstance& instance, const ShaderVariant& variant,
+                                     Render::DrawQueue& queue, DrawPath path) {
+        // 開啟 bloom 時發光邊緣不在主繪製提高亮度，另外畫一份發光量到離屏貼圖
+        // (關閉發光時同樣用 BLOOM_BASE，但不畫發光量)
+        const Geometry geometry = SelectGeometry(instance, variant);
+        const bool splitGlow = variant.edge == Modifier::EdgeType::GLOW && (m_BloomEnabled || !m_GlowEnabled);
+        const ShaderVariant drawVariant = splitGlow ? variant.WithGlowPass(GlowPass::BLOOM_BASE) : variant;
+
+        // 靜態特效的主繪製改畫烘焙好的貼圖 (發光量仍照常畫 SDF)
+        EffectInstance sprite;
+        const bool baked = path != DrawPath::LIVE && variant.animation == Modifier::AnimationType::NONE &&
+                           MakeSprite(instance, drawVariant, geometry, sprite);
+
+        // 預警只累積到遮罩，不進佇列；邊緣發光在合成時統一畫
+        if (baked && path == DrawPath::TELEGRAPH && m_MaskActive) {
+            m_MaskInstances.push_back(sprite);
+            m_MaskMaxZ = std::max(m_MaskMaxZ, instance.params.y);
+            m_MaxZ = std::max(m_MaxZ, instance.params.y);
+            return;
+        }
+
+        if (splitGlow && m_GlowEnabled) {
+            m_EmissiveInstances.push_back(instance);
+            m_EmissiveBatches.push_back(MakeBatchKey(variant.WithGlowPass(GlowPass::EMISSIVE).GetKey(), geometry));
+            m_EmissiveMaxZ = std::max(m_EmissiveMaxZ, instance.params.y);
+        }
+
+        // z-index 在 params.y，排序交給佇列 (穩定排序保留相同 z、相同變體的加入順序)
+        const uint16_t key = baked ? MakeBatchKey(0, Geometry::SPRITE) : MakeBatchKey(drawVariant.GetKey(), geometry);
+        queue.Submit(Render::DrawQueue::MakeKey(instance.params.y, Render::DrawProgram::EFFECT, key), this,
+                     static_cast<uint32_t>(m_Instances.size()));
+        m_Instances.push_back(baked ? sprite : instance);
+        m_InstanceBatches.push_back(key);
+        m_MaxZ = std::max(m_MaxZ, instance.params.y);
+    }
+
+    bool EffectBatchRenderer::MakeSprite(const EffectInstance& instance, const ShaderVariant& variant,
+                                         Geometry geometry, EffectInstance& sprite) {
+        if (!m_SpriteProgram) return false;
+        if (!m_Atlas) {
+            m_Atlas = std::make_unique<Render::TextureAtlas>(kAtlasSize);
+        }
+        if (!m_Atlas->IsValid()) return false;
+
+        // 外觀的像素範圍：圓與橢圓是整個畫布，矩形是未旋轉的長條加上邊緣 (與 Effect.vert 的四邊形相同)
+        const bool rectangle = variant.shape == ShapeClass::RECTANGLE;
+        const glm::vec2 canvas(instance.transform.z, instance.transform.w);
+        const glm::vec2 extent = rectangle
+            ? (glm::vec2(instance.shape.x, instance.shape.y) + glm::vec2(2.0f * instance.fillEdge.w)) * canvas
+            : canvas;
+        if (extent.x < 1.0f || extent.y < 1.0f) return false;
+
+        // 外觀與位置、z、時間無關；矩形的旋轉改在繪製貼圖時套用，相同長條不同角度共用一塊
+        EffectInstance look = instance;
+        look.transform = glm::vec4(0.0f, 0.0f, canvas.x, canvas.y);
+        look.params = glm::vec4(0.0f, 0.0f, 0.0f, instance.params.w);
+        look.motion = glm::vec4(0.0f);
+        if (rectangle) {
+            look.shape.w = 0.0f;
+        }
+        const uint16_t variantKey = variant.GetKey();
+        const uint64_t lookKey = HashLook(look, variantKey);
+
+        // 每幀烘焙的次數有上限 (每次都要切換 framebuffer 並讀回 viewport)，超過的當幀照常畫 SDF，之後幾幀再烘焙
+        const glm::vec4* region = m_Atlas->Find(lookKey);
+        if (!region) {
+            if (m_BakeCount >= kMaxBakesPerFrame) return false;
+            region = Bake(look, variantKey, geometry, extent, lookKey);
+            if (!region) return false;
+        }
+
+        // Effect.vert 以 shape.w 反向轉長條 (畫布 y 向下)，在畫面上等於轉 -shape.w
+        sprite = EffectInstance{};
+        sprite.transform = glm::vec4(instance.transform.x, instance.transform.y, extent.x, extent.y);
+        sprite.params = glm::vec4(instance.params.x - (rectangle ? instance.shape.w : 0.0f), instance.params.y,
+                                  0.0f, 0.0f);
+        sprite.shape = *region;
+        return true;
+    }
+
+    const glm::vec4* EffectBatchRenderer::Bake(EffectInstance look, uint16_t variantKey, Geometry geometry,
+                                               const glm::vec2& extent, uint64_t lookKey) {
+        const VariantProgram* program = GetProgram(variantKey);
+        if (!program) return nullptr;
+
+        const float scale = std::min(1.0f, kMaxBakeSize / std::max(extent.x, extent.y));
+        const auto width = static_cast<GLint>(std::ceil(extent.x * scale));
+        const auto height = static_cast<GLint>(std::ceil(extent.y * scale));
+        Render::TextureAtlas::Region region;
+        if (!m_Atlas->Allocate(width, height, region)) return nullptr;
+
+        // 畫在區塊中央 (貼圖集的像素坐標，y 向上)
+        look.transform = glm::vec4(static_cast<float>(region.x) + 0.5f * static_cast<float>(width),
+                                   static_cast<float>(region.y) + 0.5f * static_cast<float>(height),
+                                   look.transform.z * scale, look.transform.w * scale);
+
+        GLint viewport[4];
+        glGetIntegerv(GL_VIEWPORT, viewport);
+        m_Atlas->BeginRegion(region);
+
+        // 顏色先乘上 alpha 再存 (貼圖程式會還原)，區塊內只有這一個實例
+        auto& state = Render::RenderState::GetInstance();
+        state.InvalidateBindings();
+        state.SetBlend(true);
+        state.SetBlendFuncSeparate(GL_SRC_ALPHA, GL_ZERO, GL_ONE, GL_ZERO);
+        state.UseProgram(program->program);
+        program->uniforms->Set(program->projection, m_AtlasProjection);
+
+        const MeshRange& mesh = m_Meshes[static_cast<size_t>(geometry)];
+        state.BindVertexArray(geometry == Geometry::QUAD ? *m_VertexArray : *m_OutlineArray);
+        glBindBuffer(GL_ARRAY_BUFFER, m_BakeBuffer);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(EffectInstance), &look);
+        PointInstanceAttributes(0);
+        glDrawElementsInstanced(GL_TRIANGLES, mesh.indexCount, GL_UNSIGNED_INT,
+                                reinterpret_cast<const void*>(mesh.firstIndex * sizeof(unsigned int)), 1);
+
+        m_Atlas->EndRegion();
+        glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+        state.SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        state.InvalidateBindings();
+        ++m_BakeCount;
+
+        return &m_Atlas->Insert(lookKey, region);
+    }
+
+    void EffectBatchRenderer::EndSubmit(Render::DrawQueue& queue) {
+        // 預警遮罩的合成排在最高的預警 z 的特效之後
+        if (!m_MaskInstances.empty()) {
+            queue.Submit(Render::DrawQueue::MakeKey(m_MaskMaxZ, Render::DrawProgram::EFFECT, UINT16_MAX - 1), this,
+                         kMaskCompositePayload);
+        }
+        // 合成排在最高 z 的所有特效之後 (材質欄位最大)
+        if (m_LayerActive && (!m_Instances.empty() || !m_MaskInstances.empty())) {
+            queue.Submit(Render::DrawQueue::MakeKey(m_MaxZ, Render::DrawProgram::EFFECT, UINT16_MAX), this,
+                         kLayerCompositePayload);
+        }
+        // bloom 排在最高的發光特效之後，z 更高的物件 (角色、UI) 蓋在光暈之上；
+        // 使用圖層時特效在 m_MaxZ 才疊回畫面，bloom 跟在圖層合成之後 (同鍵依送出順序)
+        if (m_BloomEnabled && !m_EmissiveInstances.empty()) {
+            const uint64_t key = m_LayerActive
+                ? Render::DrawQueue::MakeKey(m_MaxZ, Render::DrawProgram::EFFECT, UINT16_MAX)
+                : Render::DrawQueue::MakeKey(m_EmissiveMaxZ, Render::DrawProgram::EFFECT, UINT16_MAX - 2);
+            queue.Submit(key, this, kBloomCompositePayload);
+        }
+    }
+
+    void EffectBatchRenderer::BeginStream() {
+        // 第一段時換到串流緩衝區的下一段，容量以本幀所有特效 (含發光量) 計
+        if (!m_StreamBegun) {
+            const size_t frameBytes = (m_Instances.size() + m_EmissiveInstances.size() + m_MaskInstances.size()) *
+                                      sizeof(EffectInstance);
+            if (frameBytes > m_InstanceStream->GetFrameCapacity()) {
+                m_InstanceStream->Reserve(frameBytes);
+                LOG_DEBUG("Effect instance stream grown to {} instances",
+                    m_InstanceStream->GetFrameCapacity() / sizeof(EffectInstance));
+            }
+            m_InstanceStream->BeginFrame();
+            m_StreamBegun = true;
+        }
+    }
+
+    void EffectBatchRenderer::DrawRun(const uint32_t* payloads, size_t count) {
+        // 遮罩、bloom 與圖層的合成排在同 z 的特效之後，但仍逐項檢查
+        size_t first = 0;
+        for (size_t i = 0; i <= count; ++i) {
+            if (i == count || payloads[i] >= kBloomCompositePayload) {
+                DrawInstances(payloads + first, i - first);
+                if (i == count) break;
+                if (payloads[i] == kMaskCompositePayload) {
+                    DrawTelegraphMask();
+                } else if (payloads[i] == kBloomCompositePayload) {
+                    DrawBloom();
+                } else {
+                    m_Layer->Composite();
+                }
+                first = i + 1;
+            }
+        }
+    }
+
+    void EffectBatchRenderer::DrawInstances(const uint32_t* payloads, size_t count) {
+        if (count == 0) return;
+        BeginStream();
+
+        m_RunInstances.clear();
+        m_RunBatches.clear();
+        for (size_t i = 0; i < count; ++i) {
+            m_RunInstances.push_back(m_Instances[payloads[i]]);
+            m_RunBatches.push_back(m_InstanceBatches[payloads[i]]);
+        }
+
+        // 前一段可能是框架的 Image 繪製，已經換掉了綁定
+        auto& state = Render::RenderState::GetInstance();
+        state.InvalidateBindings();
+        if (m_LayerActive) {
+            m_Layer->Bind();
+            DrawUploaded();
+            m_Layer->Unbind();
+        } else {
+            state.SetBlend(true);
+            state.SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+            DrawUploaded();
+        }
+    }
+
+    void EffectBatchRenderer::DrawUploaded() {
+        const size_t count = m_RunInstances.size();
+        const size_t offset = m_InstanceStream->Upload(m_RunInstances.data(), count * sizeof(EffectInstance));
+        if (offset == Render::StreamBuffer::kInvalidOffset) return;
+
+        auto& state = Render::RenderState::GetInstance();
+        glBindBuffer(GL_ARRAY_BUFFER, m_InstanceStream->GetId());
+
+        // 依批次 (變體 + 網格) 切開，每段換一次程式與網格 (整段已經一次上傳)
+        size_t first = 0;
+        while (first < count) {
+            const uint16_t key = m_RunBatches[first];
+            size_t last = first + 1;
+            while (last < count && m_RunBatches[last] == key) ++last;
+
+            if (UseBatchProgram(key)) {
+                const auto geometry = static_cast<Geometry>(key >> kVariantBits);
+                const MeshRange& mesh = m_Meshes[static_cast<size_t>(geometry)];
+                const bool quad = geometry == Geometry::QUAD || geometry == Geometry::SPRITE;
+                state.BindVertexArray(quad ? *m_VertexArray : *m_OutlineArray);
+                PointInstanceAttributes(offset + first * sizeof(EffectInstance));
+                glDrawElementsInstanced(GL_TRIANGLES, mesh.indexCount, GL_UNSIGNED_INT,
+                                        reinterpret_cast<const void*>(mesh.firstIndex * sizeof(unsigned int)),
+                                        static_cast<GLsizei>(last - first));
+                ++m_DrawCallCount;
+                m_InstanceCount += last - first;
+            }
+            first = last;
+        }
+    }
+
+    void EffectBatchRenderer::DrawTelegraphMask() {
+        if (m_MaskInstances.empty()) return;
+        BeginStream();
+
+        const size_t count = m_MaskInstances.size();
+        const size_t offset = m_InstanceStream->Upload(m_MaskInstances.data(), count * sizeof(EffectInstance));
+        if (offset == Render::StreamBuffer::kInvalidOffset) return;
+
+        // 所有預警一次 instanced draw，重疊處以 max 保留最大的覆蓋率
+        auto& state = Render::RenderState::GetInstance();
+        state.InvalidateBindings();
+        m_Mask->Bind();
+        state.UseProgram(*m_CoverageProgram);
+        m_CoverageUniforms->Set(m_CoverageProjection, m_Projection);
+        m_CoverageUniforms->Set(m_CoverageAtlas, 0);
+        state.BindTexture(m_Atlas->GetTexture(), 0);
+        state.BindVertexArray(*m_VertexArray);
+        glBindBuffer(GL_ARRAY_BUFFER, m_InstanceStream->GetId());
+        PointInstanceAttributes(offset);
+        glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr, static_cast<GLsizei>(count));
+        m_Mask->Unbind();
+        ++m_DrawCallCount;
+        m_InstanceCount += count;
+
+        // 上色合成：畫到特效圖層或直接畫到畫面 (關閉發光時不畫外緣)
+        glm::vec4 edge = m_TelegraphEdge;
+        if (!m_GlowEnabled) edge.a = 0.0f;
+        if (m_LayerActive) {
+            m_Layer->Bind();
+            m_Mask->Composite(m_TelegraphFill, edge);
+            m_Layer->Unbind();
+        } else {
+            state.SetBlend(true);
+            state.SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+            m_Mask->Composite(m_TelegraphFill, edge);
+        }
+        ++m_DrawCallCount;
+    }
+
+    void EffectBatchRenderer::DrawBloom() {
+        if (!m_Bloom || m_EmissiveInstances.empty()) return;
+        BeginStream();
+
+        // 發光量以加法混合，順序無關：依批次排好，每個批次一次 draw
+        m_EmissiveOrder.resize(m_EmissiveInstances.size());
+        for (uint32_t i = 0; i < m_EmissiveOrder.size(); ++i) m_EmissiveOrder[i] = i;
+        std::sort(m_EmissiveOrder.begin(), m_EmissiveOrder.end(), [this](uint32_t a, uint32_t b) {
+            return m_EmissiveBatches[a] < m_EmissiveBatches[b];
+        });
+        m_RunInstances.clear();
+        m_RunBatches.clear();
+        for (uint32_t index : m_EmissiveOrder) {
+            m_RunInstances.push_back(m_EmissiveInstances[index]);
+            m_RunBatches.push_back(m_EmissiveBatches[index]);
+        }
+
+        Render::RenderState::GetInstance().InvalidateBindings();
+        if (!m_Bloom->BeginEmissive()) return;
+        DrawUploaded();
+        m_Bloom->Composite();
+    }
+
+    void EffectBatchRenderer::EndFrame() {
+        if (m_StreamBegun) {
+            m_InstanceStream->EndFrame();
+            m_StreamBegun = false;
+        }
+    }
+
+} // namespace Effect
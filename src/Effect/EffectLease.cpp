@@ -0,0 +1,20 @@
+#include "Effect/EffectLease.hpp"
+#include "Effect/EffectManager.hpp"
+
+namespace Effect {
+
+    CompositeEffect* EffectLease::Get() const {
+        if (m_Handle.IsNull() || EffectManager::IsShutDown()) return nullptr;
+        return EffectManager::GetInstance().Resolve(m_Handle);
+    }
+
+    void EffectLease::Release() {
+        if (m_Handle.IsNull()) return;
+        // 程式結束時持有租約的物件可能比管理器晚解構
+        if (!EffectManager::IsShutDown()) {
+            EffectManager::GetInstance().Release(m_Handle);
+        }
+        m_Handle.Clear();
+    }
+
+} // namespace Effect
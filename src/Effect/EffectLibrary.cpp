@@ -0,0 +1,258 @@
+#include "Effect/EffectLibrary.hpp"
+#include "Effect/EffectPoolProfile.hpp"
+#include "Util/Logger.hpp"
+
+namespace Effect {
+
+    namespace {
+        constexpr size_t kNotFound = SIZE_MAX;
+
+        // 資料檔中的修飾器類型名稱，順序與列舉一致
+        constexpr const char* kFillNames[] = {"solid", "hollow"};
+        constexpr const char* kEdgeNames[] = {"none", "dark", "glow"};
+        constexpr const char* kAnimationNames[] = {"none", "ripple", "trail"};
+
+        template <typename Enum, size_t N>
+        bool ReadEnum(std::istringstream& values, const char* const (&names)[N], Enum& result) {
+            std::string name;
+            if (!(values >> name)) return false;
+            for (size_t i = 0; i < N; ++i) {
+                if (name == names[i]) {
+                    result = static_cast<Enum>(i);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // 行尾沒有值時保留預設值；有值但不是數字時算格式錯誤
+        bool ReadOptional(std::istringstream& values, float& value) {
+            values >> std::ws;
+            if (values.eof()) return true;
+            return static_cast<bool>(values >> value);
+        }
+
+        bool ReadColor(std::istringstream& values, Util::Color& color) {
+            float r = 0.0f, g = 0.0f, b = 0.0f, a = 0.0f;
+            if (!(values >> r >> g >> b >> a)) return false;
+            color = Util::Color(r, g, b, a);
+            return true;
+        }
+
+        // "[名稱]" 或 "[名稱 : 基底]"
+        bool ParseHeader(const std::string& line, std::string& name, std::string& base) {
+            const size_t close = line.find(']');
+            if (line[0] != '[' || close == std::string::npos) return false;
+
+            std::istringstream header(line.substr(1, close - 1));
+            if (!(header >> name)) return false;
+            char colon = 0;
+            if (header >> colon) {
+                return colon == ':' && static_cast<bool>(header >> base);
+            }
+            return true;
+        }
+    }
+
+    EffectLibrary::EffectLibrary() {
+        RegisterBuiltins();
+    }
+
+    void EffectLibrary::RegisterBuiltins() {
+        m_Prototypes.clear();
+        for (size_t i = 0; i < static_cast<size_t>(EffectType::COUNT); ++i) {
+            const auto type = static_cast<EffectType>(i);
+            std::string name = EffectPoolProfile::GetTypeName(type);
+            std::transform(name.begin(), name.end(), name.begin(),
+                           [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            m_Prototypes.push_back(EffectPrototype{std::move(name), type, EffectFactory::CreateEffect(type)});
+        }
+    }
+
+    bool EffectLibrary::Load(const std::string& path) {
+        RegisterBuiltins();
+
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            LOG_ERROR("No effect definitions at {}, using placeholder effects", path);
+            return false;
+        }
+
+        size_t current = kNotFound;  // 目前區塊的原型；格式錯誤的區塊整塊略過
+        size_t blocks = 0;
+        std::string line;
+        int lineNumber = 0;
+        while (std::getline(file, line)) {
+            ++lineNumber;
+            const size_t comment = line.find('#');
+            if (comment != std::string::npos) line.erase(comment);
+            const size_t start = line.find_first_not_of(" \t\r");
+            if (start == std::string::npos) continue;
+
+            if (line[start] == '[') {
+                std::string name;
+                std::string base;
+                current = kNotFound;
+                if (!ParseHeader(line.substr(start), name, base)) {
+                    LOG_WARN("Skipping malformed effect header on line {}: {}", lineNumber, line);
+                    continue;
+                }
+
+                size_t index = IndexOf(name);
+                if (!base.empty()) {
+                    const size_t baseIndex = IndexOf(base);
+                    if (baseIndex == kNotFound) {
+                        LOG_WARN("Effect '{}' on line {} uses unknown base '{}'", name, lineNumber, base);
+                        continue;
+                    }
+                    // 新的原型沿用基底的對象池；內建類型永遠使用自己的池子
+                    if (index == kNotFound) {
+                        index = m_Prototypes.size();
+                        m_Prototypes.push_back(EffectPrototype{name, m_Prototypes[baseIndex].poolType,
+                                                               m_Prototypes[baseIndex].effect});
+                    } else {
+                        m_Prototypes[index].effect = m_Prototypes[baseIndex].effect;
+                    }
+                } else if (index == kNotFound) {
+                    LOG_WARN("Effect '{}' on line {} needs a base: [{} : base]", name, lineNumber, name);
+                    continue;
+                }
+
+                current = index;
+                ++blocks;
+                continue;
+            }
+
+            if (current == kNotFound) continue;
+
+            std::istringstream values(line);
+            std::string field;
+            values >> field;
+            if (!ParseField(m_Prototypes[current].effect, field, values)) {
+                LOG_WARN("Skipping malformed effect definition line {}: {}", lineNumber, line);
+            }
+        }
+
+        LOG_INFO("Effect definitions loaded from {} ({} blocks, {} prototypes)", path, blocks, m_Prototypes.size());
+        return true;
+    }
+
+    bool EffectLibrary::ParseField(CompositeEffect& effect, const std::string& field, std::istringstream& values) {
+        if (field == "duration") {
+            float duration = 0.0f;
+            if (!(values >> duration)) return false;
+            effect.SetDuration(duration);
+            return true;
+        }
+        if (field == "color") {
+            Util::Color color;
+            if (!ReadColor(values, color)) return false;
+            effect.SetColor(color);
+            return true;
+        }
+
+        // 形狀：整個替換 (旋轉歸零、不自動旋轉)
+        if (field == "circle") {
+            float radius = 0.0f, width = 0.0f, height = 0.0f;
+            if (!(values >> radius >> width >> height)) return false;
+            effect.SetShape(Shape::CircleShape(radius, {width, height}));
+            return true;
+        }
+        if (field == "ellipse") {
+            glm::vec2 radii(0.0f);
+            float width = 0.0f, height = 0.0f;
+            if (!(values >> radii.x >> radii.y >> width >> height)) return false;
+            effect.SetShape(Shape::EllipseShape(radii, {width, height}));
+            return true;
+        }
+        if (field == "rectangle") {
+            glm::vec2 dimensions(0.0f);
+            float thickness = 0.0f, width = 0.0f, height = 0.0f;
+            if (!(values >> dimensions.x >> dimensions.y >> thickness >> width >> height)) return false;
+            effect.SetShape(Shape::RectangleShape(dimensions, thickness, 0.0f, false, 0.0f, {width, height}));
+            return true;
+        }
+        if (field == "rotation" || field == "spin") {
+            auto* rectangle = effect.GetShape<Shape::RectangleShape>();
+            float value = 0.0f;
+            if (!rectangle || !(values >> value)) return false;
+            if (field == "rotation") {
+                rectangle->SetRotation(value);
+            } else {
+                rectangle->SetAutoRotation(value != 0.0f, value);
+            }
+            return true;
+        }
+
+        // 修飾器：省略的數值使用修飾器的預設值
+        if (field == "fill") {
+            Modifier::FillType type;
+            float thickness = 0.02f;
+            if (!ReadEnum(values, kFillNames, type) || !ReadOptional(values, thickness)) return false;
+            effect.SetFillModifier(Modifier::FillModifier(type, thickness));
+            return true;
+        }
+        if (field == "edge") {
+            Modifier::EdgeType type;
+            float width = 0.05f;
+            if (!ReadEnum(values, kEdgeNames, type) || !ReadOptional(values, width)) return false;
+            Modifier::EdgeModifier edge(type, width);
+            values >> std::ws;
+            if (!values.eof()) {
+                Util::Color color;
+                if (!ReadColor(values, color)) return false;
+                edge.SetEdgeColor(color);
+            }
+            effect.SetEdgeModifier(edge);
+            return true;
+        }
+        if (field == "move") {
+            // 速度為 0 表示不移動
+            float speed = 0.0f, distance = 0.0f;
+            glm::vec2 direction(1.0f, 0.0f);
+            if (!(values >> speed >> distance >> direction.x >> direction.y)) return false;
+            effect.SetMovementModifier(Modifier::MovementModifier(speed > 0.0f, speed, distance, direction));
+            return true;
+        }
+        if (field == "bake" || field == "telegraph") {
+            // 省略數值表示開啟
+            float enabled = 1.0f;
+            if (!ReadOptional(values, enabled)) return false;
+            if (field == "bake") {
+                effect.SetBakeable(enabled != 0.0f);
+            } else {
+                effect.SetTelegraph(enabled != 0.0f);
+            }
+            return true;
+        }
+        if (field == "animation") {
+            Modifier::AnimationType type;
+            float intensity = 1.0f;
+            float speed = 1.0f;
+            if (!ReadEnum(values, kAnimationNames, type) ||
+                !ReadOptional(values, intensity) || !ReadOptional(values, speed)) {
+                return false;
+            }
+            effect.SetAnimationModifier(Modifier::AnimationModifier(type, intensity, speed));
+            return true;
+        }
+        return false;
+    }
+
+    PrototypeId EffectLibrary::Find(std::string_view name, EffectType fallback) const {
+        const size_t index = IndexOf(name);
+        if (index == kNotFound) {
+            LOG_WARN("Effect '{}' is not defined, using {}", name, EffectPoolProfile::GetTypeName(fallback));
+            return GetId(fallback);
+        }
+        return static_cast<PrototypeId>(index);
+    }
+
+    size_t EffectLibrary::IndexOf(std::string_view name) const {
+        for (size_t i = 0; i < m_Prototypes.size(); ++i) {
+            if (m_Prototypes[i].name == name) return i;
+        }
+        return kNotFound;
+    }
+
+} // namespace Effect
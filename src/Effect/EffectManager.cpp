@@ -1,80 +1,365 @@
 #include "Effect/EffectManager.hpp"
+#include "Effect/TrailRenderer.hpp"
 #include "Util/TransformUtils.hpp"
 #include "Util/Logger.hpp"
 
+#include <utility>
+
 namespace Effect {
 
+    namespace {
+        // Bounding circle against an axis-aligned rectangle
+        bool Overlaps(const glm::vec2& center, float radius, const glm::vec2& min, const glm::vec2& max) {
+            const glm::vec2 offset = center - glm::clamp(center, min, max);
+            return glm::dot(offset, offset) <= radius * radius;
+        }
+
+        // A trail can still be on screen after its head has left
+        bool TrailOverlaps(const TrailHistory& trail, float width, const glm::vec2& min, const glm::vec2& max) {
+            for (size_t age = 0; age < trail.GetCount(); ++age) {
+                if (Overlaps(trail.GetPoint(age), width, min, max)) return true;
+            }
+            return false;
+        }
+    }
+
     void EffectManager::Initialize(size_t initialPoolSize) {
-        // Make sure we initialize in specific order to ensure shader loading works properly
-        EffectType initOrder[] = {
-            EffectType::SKILL_Z,  // May contain basic shader initialization
-            EffectType::SKILL_X,
-            EffectType::SKILL_C,
-            EffectType::SKILL_V,
-            EffectType::ENEMY_ATTACK_1,
-            EffectType::ENEMY_ATTACK_2,
-            EffectType::ENEMY_ATTACK_3,
-            EffectType::RECT_LASER,
-            EffectType::RECT_BEAM,
-        };
-        
-        for (auto type : initOrder) {
-            for (size_t j = 0; j < initialPoolSize; ++j) {
-                auto effect = EffectFactory::GetInstance().CreateEffect(type);
-
-                // Store the effect type in the effect for future reference
-                effect->GetBaseShape()->SetUserData(static_cast<int>(type));
-
-                m_InactiveEffects[type].push(effect);
+        // Load (or compile) every prototype's shader variant up front, even when the
+        // profile says its pool starts empty; the binary cache makes this cheap
+        // (the no-animation variant too, so a quality drop doesn't compile mid-fight)
+        auto& renderer = EffectBatchRenderer::GetInstance();
+        bool telegraphColors = false;
+        for (const auto& prototype : EffectLibrary::GetInstance().GetPrototypes()) {
+            // The telegraph mask recolors every telegraph at once; its fill and edge
+            // colors come from the first telegraph prototype in effects.def
+            if (prototype.effect.IsTelegraph() && !telegraphColors) {
+                const Util::Color& fill = prototype.effect.GetColor();
+                const auto& edge = prototype.effect.GetEdgeModifier();
+                const Util::Color& edgeColor = edge.GetEdgeColor();
+                const float glow = edge.GetEdgeType() == Modifier::EdgeType::GLOW ? edgeColor.a : 0.0f;
+                renderer.SetTelegraphColors(glm::vec4(fill.r, fill.g, fill.b, 1.0f),
+                                            glm::vec4(edgeColor.r, edgeColor.g, edgeColor.b, glow));
+                telegraphColors = true;
+            }
+
+            const ShaderVariant variant = prototype.effect.GetShaderVariant();
+            renderer.Prepare(variant);
+            if (variant.animation != Modifier::AnimationType::NONE) {
+                ShaderVariant still = variant;
+                still.animation = Modifier::AnimationType::NONE;
+                renderer.Prepare(still);
+            }
+        }
+
+        size_t total = 0;
+        for (size_t i = 0; i < static_cast<size_t>(EffectType::COUNT); ++i) {
+            const auto type = static_cast<EffectType>(i);
+
+            // 有紀錄的類型只配置實際用到的數量
+            const size_t poolSize = m_LoadedProfile.HasType(type)
+                ? m_LoadedProfile.GetHighWater(type)
+                : initialPoolSize;
+
+            auto& freeSlots = m_FreeSlots[static_cast<size_t>(type)];
+            freeSlots.reserve(freeSlots.size() + poolSize);
+            for (size_t j = 0; j < poolSize; ++j) {
+                freeSlots.push_back(CreateSlot(type));
             }
+            total += poolSize;
+            LOG_DEBUG("Effect pool {}: {} effects", EffectPoolProfile::GetTypeName(type), poolSize);
+        }
+        m_Active.reserve(m_Active.size() + total);
+        m_Initialized = true;
+        LOG_INFO("EffectManager initialized with {} effects ({} per type without profile)", total, initialPoolSize);
+    }
+
+    void EffectManager::LoadPoolProfile(const std::string& path) {
+        m_ProfilePath = path;
+        m_LoadedProfile = EffectPoolProfile{};
+        m_LoadedProfile.Load(path);
+    }
+
+    void EffectManager::SavePoolProfile() const {
+        if (m_ProfilePath.empty()) return;
+
+        // 最大使用數與載入的紀錄取較大值，多玩幾次後池子大小會收斂到整場戰鬥的需求；
+        // 不夠用的次數只存這次的，池子配置足夠後檔案中會是 0
+        EffectPoolProfile merged = m_LoadedProfile;
+        merged.Merge(m_Profile);
+        if (merged.Save(m_ProfilePath)) {
+            LOG_INFO("Effect pool profile saved to {} ({} pool misses this run)", m_ProfilePath, m_PoolMisses);
+        }
+    }
+
+    uint32_t EffectManager::CreateSlot(EffectType type) {
+        m_Slots.push_back(Slot{EffectLibrary::GetInstance().Get(EffectLibrary::GetId(type)).effect, type});
+        return static_cast<uint32_t>(m_Slots.size() - 1);
+    }
+
+    void EffectManager::ReleaseSlot(uint32_t index) {
+        Slot& slot = m_Slots[index];
+        slot.effect.Reset();
+        slot.inUse = false;
+        slot.idleTime = 0.0f;
+        slot.wasPlayed = false;
+        slot.idleReported = false;
+        slot.trail.Clear();
+        ++slot.generation;
+        --m_InUseByType[static_cast<size_t>(slot.type)];
+
+        // Swap-and-pop out of the dense active list
+        const uint32_t last = m_Active.back();
+        m_Active[slot.activeIndex] = last;
+        m_Slots[last].activeIndex = slot.activeIndex;
+        m_Active.pop_back();
+
+        // Return effect to its proper pool
+        m_FreeSlots[static_cast<size_t>(slot.type)].push_back(index);
+        LOG_DEBUG("Returned effect to pool, type: {}", static_cast<int>(slot.type));
+    }
+
+    uint32_t EffectManager::EnsureFree(EffectType type, size_t count) {
+        auto& freeSlots = m_FreeSlots[static_cast<size_t>(type)];
+        if (freeSlots.size() >= count) return 0;
+
+        // Create the missing effects; before Initialize this is just filling the pool
+        const auto missing = static_cast<uint32_t>(count - freeSlots.size());
+        freeSlots.reserve(count);
+        for (uint32_t i = 0; i < missing; ++i) {
+            freeSlots.push_back(CreateSlot(type));
         }
-        LOG_INFO("EffectManager initialized with {} effects per type", initialPoolSize);
+        if (!m_Initialized) return 0;
+
+        m_PoolMisses += missing;
+        LOG_DEBUG("Effect pool miss, created {} new effects, type: {}", missing, EffectPoolProfile::GetTypeName(type));
+        return missing;
+    }
+
+    uint32_t EffectManager::ClaimFree(EffectType type) {
+        auto& freeSlots = m_FreeSlots[static_cast<size_t>(type)];
+        const uint32_t index = freeSlots.back();
+        freeSlots.pop_back();
+
+        Slot& slot = m_Slots[index];
+        slot.inUse = true;
+        slot.activeIndex = static_cast<uint32_t>(m_Active.size());
+        m_Active.push_back(index);
+        return index;
     }
 
-    std::shared_ptr<CompositeEffect> EffectManager::GetEffect(EffectType type) {
-        std::shared_ptr<CompositeEffect> effect;
+    EffectHandle EffectManager::GetEffect(PrototypeId prototypeId) {
+        const EffectPrototype& prototype = EffectLibrary::GetInstance().Get(prototypeId);
+        const EffectType type = prototype.poolType;
 
-        // Try to get effect from the pool
-        if (!m_InactiveEffects[type].empty()) {
-            effect = m_InactiveEffects[type].front();
-            m_InactiveEffects[type].pop();
+        const uint32_t misses = EnsureFree(type, 1);
+        const uint32_t index = ClaimFree(type);
+        if (misses == 0) {
             LOG_DEBUG("Retrieved effect from pool, type: {}", static_cast<int>(type));
-        } else {
-            // Create new effect
-            effect = EffectFactory::GetInstance().CreateEffect(type);
+        }
+
+        const uint32_t inUse = ++m_InUseByType[static_cast<size_t>(type)];
+        m_Profile.RecordAcquire(m_ProfilePhase, type, inUse, misses);
+
+        // Copy the prototype's whole parameter block; effects are plain values, so this
+        // allocates nothing and leaves nothing behind from the previous user
+        Slot& slot = m_Slots[index];
+        slot.effect = prototype.effect;
+        return EffectHandle{index, slot.generation};
+    }
+
+    void EffectManager::PlayEffects(const Spawn* spawns, size_t count, EffectHandle* handles) {
+        if (count == 0) return;
+        const auto& library = EffectLibrary::GetInstance();
+
+        // One pool operation per type: count what the batch needs and top the free lists up once
+        std::array<uint32_t, static_cast<size_t>(EffectType::COUNT)> needed{};
+        for (size_t i = 0; i < count; ++i) {
+            ++needed[static_cast<size_t>(library.Get(spawns[i].prototype).poolType)];
+        }
+        std::array<uint32_t, static_cast<size_t>(EffectType::COUNT)> misses{};
+        for (size_t t = 0; t < needed.size(); ++t) {
+            if (needed[t] > 0) {
+                misses[t] = EnsureFree(static_cast<EffectType>(t), needed[t]);
+            }
+        }
+        m_Active.reserve(m_Active.size() + count);
+
+        // Claim, copy the prototype and apply the per-spawn values in one pass
+        for (size_t i = 0; i < count; ++i) {
+            const Spawn& spawn = spawns[i];
+            const EffectPrototype& prototype = library.Get(spawn.prototype);
+            const uint32_t index = ClaimFree(prototype.poolType);
+
+            CompositeEffect& effect = m_Slots[index].effect;
+            effect = prototype.effect;
+            if (auto* rectangle = effect.GetShape<Shape::RectangleShape>()) {
+                if (spawn.rotation) rectangle->SetRotation(*spawn.rotation);
+                if (spawn.dimensions) rectangle->SetDimensions(*spawn.dimensions);
+            }
+            if (spawn.size) effect.SetSize(*spawn.size);
+            if (spawn.color) effect.SetColor(*spawn.color);
+            if (spawn.duration) effect.SetDuration(*spawn.duration);
+            effect.Play(spawn.position, spawn.zIndex);
+
+            handles[i] = EffectHandle{index, m_Slots[index].generation};
+        }
 
-            // Store the effect type in the effect for future reference
-            effect->GetBaseShape()->SetUserData(static_cast<int>(type));
+        for (size_t t = 0; t < needed.size(); ++t) {
+            if (needed[t] == 0) continue;
+            m_InUseByType[t] += needed[t];
+            m_Profile.RecordAcquire(m_ProfilePhase, static_cast<EffectType>(t), m_InUseByType[t], misses[t]);
+        }
+    }
+
+    bool EffectManager::Release(const EffectHandle& handle) {
+        if (!Resolve(handle)) return false;
+        ReleaseSlot(handle.index);
+        return true;
+    }
+
+    const CompositeEffect* EffectManager::Resolve(const EffectHandle& handle) const {
+        if (handle.index >= m_Slots.size()) return nullptr;
+
+        const Slot& slot = m_Slots[handle.index];
+        if (!slot.inUse || slot.generation != handle.generation) {
+            // The effect was recycled; the holder must not touch whoever owns it now
+            return nullptr;
+        }
+        return &slot.effect;
+    }
+
+    CompositeEffect* EffectManager::Resolve(const EffectHandle& handle) {
+        return const_cast<CompositeEffect*>(std::as_const(*this).Resolve(handle));
+    }
+
+    void EffectManager::SetQualityTier(QualityTier tier) {
+        m_QualityTier = tier;
+        // Glow is a renderer-wide switch; animation is stripped per variant in ApplyQuality
+        auto& renderer = EffectBatchRenderer::GetInstance();
+        renderer.SetGlowEnabled(tier < QualityTier::NO_GLOW);
+        renderer.SetReducedResolution(tier >= QualityTier::REDUCED_RESOLUTION);
+    }
 
-            LOG_DEBUG("Created new effect, type: {}", static_cast<int>(type));
+    ShaderVariant EffectManager::ApplyQuality(ShaderVariant variant) const {
+        if (m_QualityTier >= QualityTier::NO_ANIMATION) {
+            variant.animation = Modifier::AnimationType::NONE;
         }
+        return variant;
+    }
+
+    bool EffectManager::ShouldRetire(const CompositeEffect& effect) const {
+        if (!effect.IsMoving()) return false;
+
+        const glm::vec2 arenaMin = m_ViewMin - glm::vec2(m_RetireMargin);
+        const glm::vec2 arenaMax = m_ViewMax + glm::vec2(m_RetireMargin);
+        const glm::vec2 position = effect.GetPosition();
+        if (Overlaps(position, effect.GetBoundingRadius(), arenaMin, arenaMax)) return false;
 
-        m_ActiveEffects.push_back(effect);
-        return effect;
+        // 從場地外飛進來的 (角落生成的彈幕) 還不能回收：只有停下或正在遠離場地時才結束
+        const glm::vec2 outward = position - glm::clamp(position, arenaMin, arenaMax);
+        return glm::dot(effect.GetVelocity(), outward) >= 0.0f;
     }
 
-    void EffectManager::Draw() {
-        for (auto& effect : m_ActiveEffects) {
-            if (effect->IsActive()) {
-                // Get transformation matrix
-                auto data = Util::ConvertToUniformBufferData(
-                    Util::Transform{effect->GetPosition(), 0, {1, 1}},
-                    effect->GetSize(),
-                    effect->GetBaseShape()->GetZIndex()
-                );
-                effect->Draw(data);
+    EffectBatchRenderer::DrawPath EffectManager::SelectDrawPath(const CompositeEffect& effect) {
+        if (!effect.IsBakeable()) return EffectBatchRenderer::DrawPath::LIVE;
+        return effect.IsTelegraph() ? EffectBatchRenderer::DrawPath::TELEGRAPH : EffectBatchRenderer::DrawPath::BAKED;
+    }
+
+    void EffectManager::Submit(Render::DrawQueue& queue) {
+        // Every active effect becomes one queue item keyed by its own z-index;
+        // effects that end up adjacent after sorting share one instanced draw
+        auto& renderer = EffectBatchRenderer::GetInstance();
+        renderer.Begin();
+
+        // Trails of every moving effect go out as one strip per z, drawn below the effects at that z
+        auto& trails = TrailRenderer::GetInstance();
+        trails.Begin();
+        const bool drawTrails = m_QualityTier < QualityTier::NO_ANIMATION;
+
+        // Effects whose bounds miss the view rectangle never reach the queue
+        m_CulledCount = 0;
+        EffectInstance instance;
+        for (uint32_t index : m_Active) {
+            const Slot& slot = m_Slots[index];
+            const auto& effect = slot.effect;
+            if (effect.IsActive()) {
+                const glm::vec2 position = effect.GetPosition();
+                const bool visible = Overlaps(position, effect.GetBoundingRadius(), m_ViewMin, m_ViewMax);
+                if (visible) {
+                    effect.WriteInstance(instance);
+                    renderer.Submit(instance, ApplyQuality(effect.GetShaderVariant()), queue, SelectDrawPath(effect));
+                } else {
+                    ++m_CulledCount;
+                }
+
+                if (drawTrails && effect.HasTrail()) {
+                    const float width = effect.GetTrailWidth();
+                    if (visible || TrailOverlaps(slot.trail, width, m_ViewMin, m_ViewMax)) {
+                        const Util::Color& color = effect.GetColor();
+                        trails.AddTrail(slot.trail, position, width,
+                                        glm::vec4(color.r, color.g, color.b, color.a), effect.GetZIndex());
+                    }
+                }
             }
         }
+        renderer.EndSubmit(queue);
+        trails.Submit(queue);
+
+        // Particles: one item (and one instanced draw) per emitter
+        if (m_Emitters.empty()) return;
+        ParticleEmitter::BeginBatch(GetParticleCount());
+        for (size_t i = 0; i < m_Emitters.size(); ++i) {
+            const auto& emitter = *m_Emitters[i];
+            if (emitter.GetParticleCount() == 0) continue;
+            queue.Submit(Render::DrawQueue::MakeKey(emitter.GetZIndex(), Render::DrawProgram::PARTICLE), this,
+                         static_cast<uint32_t>(i));
+        }
+    }
+
+    void EffectManager::DrawRun(const uint32_t* payloads, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            m_Emitters[payloads[i]]->Draw();
+        }
+    }
+
+    void EffectManager::EndFrame() {
+        ParticleEmitter::EndBatch();
+    }
+
+    ParticleEmitter* EffectManager::CreateEmitter(const ParticleEmitter::Settings& settings,
+                                                  const glm::vec2& position, float zIndex) {
+        auto emitter = std::make_unique<ParticleEmitter>(settings, zIndex);
+        emitter->SetPosition(position);
+        m_Emitters.push_back(std::move(emitter));
+        return m_Emitters.back().get();
+    }
+
+    void EffectManager::DestroyEmitter(const ParticleEmitter* emitter) {
+        auto it = std::find_if(m_Emitters.begin(), m_Emitters.end(),
+            [emitter](const auto& owned) { return owned.get() == emitter; });
+        if (it == m_Emitters.end()) return;
+
+        std::swap(*it, m_Emitters.back());
+        m_Emitters.pop_back();
+    }
+
+    size_t EffectManager::GetParticleCount() const {
+        size_t count = 0;
+        for (const auto& emitter : m_Emitters) {
+            count += emitter->GetParticleCount();
+        }
+        return count;
     }
 
-    std::shared_ptr<CompositeEffect> EffectManager::PlayEffect(
+    EffectHandle EffectManager::PlayEffect(
         EffectType type,
         const glm::vec2& position,
         float zIndex,
         float duration
     ) {
         // Get effect
-        auto effect = GetEffect(type);
+        auto handle = GetEffect(type);
+        auto effect = Resolve(handle);
 
         // Set duration
         effect->SetDuration(duration);
@@ -82,31 +367,83 @@ namespace Effect {
         // Play effect
         effect->Play(position, zIndex);
 
-        return effect;
+        return handle;
     }
 
     void EffectManager::Update(float deltaTime) {
-        for (auto it = m_ActiveEffects.begin(); it != m_ActiveEffects.end();) {
-            auto effect = *it;
-            effect->Update(deltaTime);
+        m_RetiredCount = 0;
+
+        // 只走訪使用中的特效；回收時最後一個會換到目前位置，所以不前進
+        for (size_t i = 0; i < m_Active.size();) {
+            const uint32_t index = m_Active[i];
+            Slot& slot = m_Slots[index];
+            auto& leaks = m_Leaks[static_cast<size_t>(slot.type)];
 
-            if (effect->IsFinished()) {
-                // Reset effect
-                effect->Reset();
+            if (slot.effect.IsActive()) {
+                slot.wasPlayed = true;
+                slot.idleTime = 0.0f;
 
-                // Get the effect type from user data
-                int typeValue = effect->GetBaseShape()->GetUserData();
-                EffectType type = static_cast<EffectType>(typeValue);
+                slot.effect.Update(deltaTime);
+                if (slot.effect.HasTrail() && slot.effect.IsActive()) {
+                    slot.trail.Advance(deltaTime, slot.effect.GetPosition());
+                }
+                if (m_AutoRetire && slot.effect.IsActive() && ShouldRetire(slot.effect)) {
+                    ++m_RetiredCount;
+                    ReleaseSlot(index);
+                    continue;
+                }
+            } else if (!slot.effect.IsFinished()) {
+                // 被取走卻沒在播放：從沒播放過，或是被手動 Reset 而沒有還回來。
+                // 只記錄並警告一次，特效仍屬於持有者 (租約解構或 Release 時才回到對象池)
+                slot.idleTime += deltaTime;
+                if (slot.idleTime >= kIdleReportTime && !slot.idleReported) {
+                    slot.idleReported = true;
+                    ++(slot.wasPlayed ? leaks.abandoned : leaks.neverPlayed);
+                    LOG_WARN("Effect {} {} for {:.1f} s without being released",
+                             EffectPoolProfile::GetTypeName(slot.type),
+                             slot.wasPlayed ? "reset" : "acquired but never played", slot.idleTime);
+                }
+            }
 
-                // Return effect to its proper pool
-                m_InactiveEffects[type].push(effect);
-                LOG_DEBUG("Returned effect to pool, type: {}", typeValue);
+            if (slot.effect.IsFinished()) {
+                ReleaseSlot(index);
+            } else {
+                ++i;
+            }
+        }
 
-                // Remove from active list
-                it = m_ActiveEffects.erase(it);
+        for (size_t i = 0; i < m_Emitters.size();) {
+            auto& emitter = *m_Emitters[i];
+            emitter.Update(deltaTime);
+            if (emitter.IsAutoRemove() && emitter.IsIdle()) {
+                std::swap(m_Emitters[i], m_Emitters.back());
+                m_Emitters.pop_back();
             } else {
-                ++it;
+                ++i;
             }
         }
     }
-}
\ No newline at end of file
+
+    void EffectManager::LogLeakReport() const {
+        bool clean = true;
+        for (size_t i = 0; i < m_Leaks.size(); ++i) {
+            const auto& leaks = m_Leaks[i];
+            if (leaks.neverPlayed == 0 && leaks.abandoned == 0) continue;
+
+            clean = false;
+            LOG_WARN("Effect leaks {}: {} never played, {} reset without release",
+                     EffectPoolProfile::GetTypeName(static_cast<EffectType>(i)),
+                     leaks.neverPlayed, leaks.abandoned);
+        }
+        if (clean) {
+            LOG_INFO("Effect leak report: clean ({} effects still in use)", m_Active.size());
+        }
+    }
+
+    void EffectManager::ClearAllEffects() {
+        while (!m_Active.empty()) {
+            ReleaseSlot(m_Active.back());
+        }
+        m_Emitters.clear();
+    }
+}
@@ -0,0 +1,136 @@
+#include "Effect/EffectPoolProfile.hpp"
+#include "Util/Logger.hpp"
+
+namespace Effect {
+
+    namespace {
+        // 以名稱存檔，EffectType 調整順序後舊的紀錄仍然可用
+        constexpr const char* kTypeNames[] = {
+            "SKILL_Z",
+            "SKILL_X",
+            "SKILL_C",
+            "SKILL_V",
+            "ENEMY_ATTACK_1",
+            "ENEMY_ATTACK_2",
+            "ENEMY_ATTACK_3",
+            "RECT_LASER",
+            "RECT_BEAM",
+        };
+        static_assert(std::size(kTypeNames) == EffectPoolProfile::kTypeCount,
+                      "kTypeNames must list every EffectType");
+
+        bool ParseType(const std::string& name, EffectType& type) {
+            for (size_t i = 0; i < std::size(kTypeNames); ++i) {
+                if (name == kTypeNames[i]) {
+                    type = static_cast<EffectType>(i);
+                    return true;
+                }
+            }
+            return false;
+        }
+    }
+
+    const char* EffectPoolProfile::GetTypeName(EffectType type) {
+        const auto index = static_cast<size_t>(type);
+        return index < kTypeCount ? kTypeNames[index] : "UNKNOWN";
+    }
+
+    void EffectPoolProfile::RecordAcquire(const PhaseKey& phase, EffectType type, uint32_t inUse, uint32_t misses) {
+        Entry& entry = m_Rows[phase][static_cast<size_t>(type)];
+        entry.highWater = std::max(entry.highWater, inUse);
+        entry.misses += misses;
+    }
+
+    void EffectPoolProfile::Merge(const EffectPoolProfile& other) {
+        // 不夠用的次數只留新的紀錄 (沒出現的關卡為 0)，才看得出池子調整後是否已經不再不夠用
+        for (auto& [phase, row] : m_Rows) {
+            for (auto& entry : row) {
+                entry.misses = 0;
+            }
+        }
+        for (const auto& [phase, row] : other.m_Rows) {
+            Row& mine = m_Rows[phase];
+            for (size_t i = 0; i < kTypeCount; ++i) {
+                mine[i].highWater = std::max(mine[i].highWater, row[i].highWater);
+                mine[i].misses = row[i].misses;
+            }
+        }
+    }
+
+    uint32_t EffectPoolProfile::GetHighWater(EffectType type) const {
+        uint32_t highWater = 0;
+        for (const auto& [phase, row] : m_Rows) {
+            highWater = std::max(highWater, row[static_cast<size_t>(type)].highWater);
+        }
+        return highWater;
+    }
+
+    uint32_t EffectPoolProfile::GetTotalMisses() const {
+        uint32_t misses = 0;
+        for (const auto& [phase, row] : m_Rows) {
+            for (const auto& entry : row) {
+                misses += entry.misses;
+            }
+        }
+        return misses;
+    }
+
+    bool EffectPoolProfile::HasType(EffectType type) const {
+        for (const auto& [phase, row] : m_Rows) {
+            const Entry& entry = row[static_cast<size_t>(type)];
+            if (entry.highWater > 0 || entry.misses > 0) return true;
+        }
+        return false;
+    }
+
+    bool EffectPoolProfile::Load(const std::string& path) {
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            LOG_INFO("No effect pool profile at {}, using default pool sizes", path);
+            return false;
+        }
+
+        std::string line;
+        int lineNumber = 0;
+        while (std::getline(file, line)) {
+            ++lineNumber;
+            if (line.empty() || line[0] == '#') continue;
+
+            std::istringstream stream(line);
+            int mainPhase = 0;
+            int subPhase = 0;
+            char dash = 0;
+            std::string typeName;
+            Entry entry;
+            EffectType type;
+            if (!(stream >> mainPhase >> dash >> subPhase >> typeName >> entry.highWater >> entry.misses) ||
+                dash != '-' || !ParseType(typeName, type)) {
+                LOG_WARN("Skipping malformed effect pool profile line {}: {}", lineNumber, line);
+                continue;
+            }
+            m_Rows[{mainPhase, subPhase}][static_cast<size_t>(type)] = entry;
+        }
+
+        LOG_INFO("Effect pool profile loaded from {} ({} phases)", path, m_Rows.size());
+        return true;
+    }
+
+    bool EffectPoolProfile::Save(const std::string& path) const {
+        std::ofstream file(path);
+        if (!file.is_open()) {
+            LOG_ERROR("Failed to write effect pool profile to {}", path);
+            return false;
+        }
+
+        file << "# effect pool profile: phase type high-water misses\n";
+        for (const auto& [phase, row] : m_Rows) {
+            for (size_t i = 0; i < kTypeCount; ++i) {
+                if (row[i].highWater == 0 && row[i].misses == 0) continue;
+                file << phase.first << '-' << phase.second << ' ' << kTypeNames[i] << ' '
+                     << row[i].highWater << ' ' << row[i].misses << '\n';
+            }
+        }
+        return true;
+    }
+
+} // namespace Effect
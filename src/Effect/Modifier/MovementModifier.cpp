@@ -7,30 +7,35 @@ namespace Effect {
             : m_IsMoving(isMoving), m_Speed(speed), m_MaxDistance(distance), m_Direction(glm::normalize(direction)) {
         }
 
-        void MovementModifier::Update(float deltaTime, glm::vec2& position) {
-            if (!m_IsMoving) return;
+        void MovementModifier::Start(const glm::vec2& startPosition, float directionScale) {
+            m_StartPosition = startPosition;
+            m_DirectionScale = directionScale;
+        }
 
-            // 計算移動距離
-            float moveDistance = m_Speed * deltaTime;
-            m_DistanceTraveled += moveDistance;
+        glm::vec2 MovementModifier::Evaluate(float elapsed) const {
+            if (!m_IsMoving) return m_StartPosition;
 
-            // 更新位置
-            position = m_StartPosition + m_Direction * m_DistanceTraveled;
+            // 與 Effect.vert 相同的算法：沿速度方向前進，最多 m_MaxDistance
+            const glm::vec2 velocity = GetVelocity();
+            const float speed = glm::length(velocity);
+            if (speed <= 0.0f) return m_StartPosition;
 
-            // 檢查是否到達目標距離
-            if (m_DistanceTraveled >= m_MaxDistance) {
-                m_IsMoving = false; // 停止移動
-            }
+            const float traveled = std::min(speed * elapsed, m_MaxDistance);
+            return m_StartPosition + velocity / speed * traveled;
         }
 
-        void MovementModifier::Reset() {
-            m_DistanceTraveled = 0.0f;
+        bool MovementModifier::HasReachedDestination(float elapsed) const {
+            if (!m_IsMoving) return false;
+            return std::abs(m_Speed * m_DirectionScale) * elapsed >= m_MaxDistance;
         }
 
-
-        bool MovementModifier::HasReachedDestination() const {
-            return !m_IsMoving || m_DistanceTraveled >= m_MaxDistance;
+        void MovementModifier::Apply(EffectInstance& instance) const {
+            if (!m_IsMoving) {
+                instance.motion = glm::vec4(0.0f);
+                return;
+            }
+            instance.motion = glm::vec4(GetVelocity(), m_MaxDistance, 1.0f);
         }
 
     } // namespace Modifier
-} // namespace Effect
\ No newline at end of file
+} // namespace Effect
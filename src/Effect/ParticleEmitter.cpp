@@ -0,0 +1,218 @@
+#include "Effect/ParticleEmitter.hpp"
+#include "Render/RenderState.hpp"
+#include "Util/Logger.hpp"
+#include "Util/TransformUtils.hpp"
+
+namespace Effect {
+
+    std::unique_ptr<Render::ShaderProgram> ParticleEmitter::s_Program = nullptr;
+    std::unique_ptr<Render::UniformTable> ParticleEmitter::s_Uniforms = nullptr;
+    Render::UniformTable::Id ParticleEmitter::s_ProjectionUniform = Render::UniformTable::kInvalid;
+    std::unique_ptr<Core::VertexArray> ParticleEmitter::s_VertexArray = nullptr;
+    std::unique_ptr<Render::StreamBuffer> ParticleEmitter::s_InstanceStream = nullptr;
+    std::vector<ParticleInstance> ParticleEmitter::s_Instances;
+    glm::mat4 ParticleEmitter::s_Projection = glm::mat4(1.0f);
+
+    namespace {
+        constexpr GLuint kFirstInstanceAttribute = 2;
+        constexpr GLuint kInstanceAttributeCount = sizeof(ParticleInstance) / sizeof(glm::vec4);
+        constexpr size_t kInitialInstanceCapacity = 4096;
+
+        void PointInstanceAttributes(size_t offset) {
+            for (GLuint i = 0; i < kInstanceAttributeCount; ++i) {
+                glVertexAttribPointer(
+                    kFirstInstanceAttribute + i, 4, GL_FLOAT, GL_FALSE, sizeof(ParticleInstance),
+                    reinterpret_cast<const void*>(offset + i * sizeof(glm::vec4)));
+            }
+        }
+    }
+
+    ParticleEmitter::ParticleEmitter(const Settings& settings, float zIndex)
+        : m_Settings(settings),
+          m_ZIndex(zIndex),
+          m_Random(std::random_device{}()) {
+        const size_t capacity = m_Settings.maxParticles;
+        m_PositionX.resize(capacity);
+        m_PositionY.resize(capacity);
+        m_VelocityX.resize(capacity);
+        m_VelocityY.resize(capacity);
+        m_Age.resize(capacity);
+        m_Lifetime.resize(capacity);
+    }
+
+    void ParticleEmitter::Burst(size_t count) {
+        Spawn(count);
+    }
+
+    void ParticleEmitter::Spawn(size_t count) {
+        count = std::min(count, m_PositionX.size() - m_Count);
+        if (count == 0) return;
+
+        const float baseAngle = std::atan2(m_Settings.direction.y, m_Settings.direction.x);
+        std::uniform_real_distribution<float> angle(baseAngle - m_Settings.spread, baseAngle + m_Settings.spread);
+        std::uniform_real_distribution<float> speed(m_Settings.speedMin, m_Settings.speedMax);
+        std::uniform_real_distribution<float> lifetime(m_Settings.lifetimeMin, m_Settings.lifetimeMax);
+
+        for (size_t i = m_Count; i < m_Count + count; ++i) {
+            const float a = angle(m_Random);
+            const float s = speed(m_Random);
+            m_PositionX[i] = m_Position.x;
+            m_PositionY[i] = m_Position.y;
+            m_VelocityX[i] = std::cos(a) * s;
+            m_VelocityY[i] = std::sin(a) * s;
+            m_Age[i] = 0.0f;
+            m_Lifetime[i] = std::max(lifetime(m_Random), 0.001f);
+        }
+        m_Count += count;
+    }
+
+    void ParticleEmitter::Update(float deltaTime) {
+        if (m_Emitting && m_Settings.emissionRate > 0.0f) {
+            m_EmitAccumulator += m_Settings.emissionRate * deltaTime;
+            const auto spawn = static_cast<size_t>(m_EmitAccumulator);
+            m_EmitAccumulator -= static_cast<float>(spawn);
+            Spawn(spawn);
+        }
+
+        // 積分：各陣列獨立、沒有分支，編譯器可以向量化
+        const float gx = m_Settings.gravity.x * deltaTime;
+        const float gy = m_Settings.gravity.y * deltaTime;
+        const float damping = std::max(0.0f, 1.0f - m_Settings.drag * deltaTime);
+        float* px = m_PositionX.data();
+        float* py = m_PositionY.data();
+        float* vx = m_VelocityX.data();
+        float* vy = m_VelocityY.data();
+        float* age = m_Age.data();
+        for (size_t i = 0; i < m_Count; ++i) {
+            vx[i] = (vx[i] + gx) * damping;
+            vy[i] = (vy[i] + gy) * damping;
+            px[i] += vx[i] * deltaTime;
+            py[i] += vy[i] * deltaTime;
+            age[i] += deltaTime;
+        }
+
+        // 移除壽命結束的粒子：與最後一個交換，保持存活粒子連續
+        for (size_t i = 0; i < m_Count;) {
+            if (m_Age[i] < m_Lifetime[i]) {
+                ++i;
+                continue;
+            }
+            const size_t last = --m_Count;
+            m_PositionX[i] = m_PositionX[last];
+            m_PositionY[i] = m_PositionY[last];
+            m_VelocityX[i] = m_VelocityX[last];
+            m_VelocityY[i] = m_VelocityY[last];
+            m_Age[i] = m_Age[last];
+            m_Lifetime[i] = m_Lifetime[last];
+        }
+    }
+
+    void ParticleEmitter::WriteInstances() const {
+        const glm::vec4 colorStart(m_Settings.colorStart.r, m_Settings.colorStart.g,
+                                   m_Settings.colorStart.b, m_Settings.colorStart.a);
+        const glm::vec4 colorEnd(m_Settings.colorEnd.r, m_Settings.colorEnd.g,
+                                 m_Settings.colorEnd.b, m_Settings.colorEnd.a);
+
+        s_Instances.resize(m_Count);
+        for (size_t i = 0; i < m_Count; ++i) {
+            const float t = m_Age[i] / m_Lifetime[i];
+            const float size = m_Settings.sizeStart + (m_Settings.sizeEnd - m_Settings.sizeStart) * t;
+            s_Instances[i].positionSize = glm::vec4(m_PositionX[i], m_PositionY[i], size, m_ZIndex);
+            s_Instances[i].color = colorStart + (colorEnd - colorStart) * t;
+        }
+    }
+
+    void ParticleEmitter::InitializeResources() {
+        try {
+            s_Program = std::make_unique<Render::ShaderProgram>(
+                GA_RESOURCE_DIR "/shaders/Particle.vert",
+                GA_RESOURCE_DIR "/shaders/Particle.frag");
+            s_Uniforms = std::make_unique<Render::UniformTable>(s_Program->GetId());
+            s_ProjectionUniform = s_Uniforms->Find("u_Projection");
+            LOG_INFO("Particle shaders loaded successfully");
+        } catch (const std::exception& e) {
+            LOG_ERROR("Failed to load particle shaders: {}", e.what());
+            s_Program.reset();
+            return;
+        }
+
+        s_VertexArray = std::make_unique<Core::VertexArray>();
+        s_VertexArray->AddVertexBuffer(std::make_unique<Core::VertexBuffer>(
+            std::vector<float>{
+                -0.5f, 0.5f,   // top left
+                -0.5f, -0.5f,  // bottom left
+                0.5f, -0.5f,   // bottom right
+                0.5f, 0.5f     // top right
+            },
+            2));
+        s_VertexArray->AddVertexBuffer(std::make_unique<Core::VertexBuffer>(
+            std::vector<float>{
+                0.0f, 0.0f,  // top left
+                0.0f, 1.0f,  // bottom left
+                1.0f, 1.0f,  // bottom right
+                1.0f, 0.0f   // top right
+            },
+            2));
+        s_VertexArray->SetIndexBuffer(std::make_unique<Core::IndexBuffer>(
+            std::vector<unsigned int>{
+                0, 1, 2,
+                0, 2, 3
+            }));
+
+        s_InstanceStream = std::make_unique<Render::StreamBuffer>(
+            GL_ARRAY_BUFFER, kInitialInstanceCapacity * sizeof(ParticleInstance), sizeof(ParticleInstance));
+        s_VertexArray->Bind();
+        glBindBuffer(GL_ARRAY_BUFFER, s_InstanceStream->GetId());
+        for (GLuint i = 0; i < kInstanceAttributeCount; ++i) {
+            glEnableVertexAttribArray(kFirstInstanceAttribute + i);
+            glVertexAttribDivisor(kFirstInstanceAttribute + i, 1);
+        }
+        PointInstanceAttributes(0);
+        s_VertexArray->Unbind();
+
+        s_Projection = Util::ConvertToUniformBufferData(Util::Transform{}, {1.0f, 1.0f}, 0.0f).m_Projection;
+    }
+
+    void ParticleEmitter::BeginBatch(size_t totalParticles) {
+        if (!s_VertexArray) {
+            InitializeResources();
+        }
+        if (!s_Program) return;
+
+        const size_t bytes = totalParticles * sizeof(ParticleInstance);
+        if (bytes > s_InstanceStream->GetFrameCapacity()) {
+            s_InstanceStream->Reserve(bytes);
+            LOG_DEBUG("Particle instance stream grown to {} particles",
+                s_InstanceStream->GetFrameCapacity() / sizeof(ParticleInstance));
+        }
+        s_InstanceStream->BeginFrame();
+    }
+
+    void ParticleEmitter::Draw() const {
+        if (m_Count == 0 || !s_Program) return;
+
+        WriteInstances();
+        const size_t offset = s_InstanceStream->Upload(s_Instances.data(), m_Count * sizeof(ParticleInstance));
+        if (offset == Render::StreamBuffer::kInvalidOffset) return;
+
+        // 前一段可能是框架的 Image 繪製，已經換掉了綁定
+        auto& state = Render::RenderState::GetInstance();
+        state.InvalidateBindings();
+        state.SetBlend(true);
+        state.SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        state.UseProgram(*s_Program);
+        s_Uniforms->Set(s_ProjectionUniform, s_Projection);
+
+        state.BindVertexArray(*s_VertexArray);
+        glBindBuffer(GL_ARRAY_BUFFER, s_InstanceStream->GetId());
+        PointInstanceAttributes(offset);
+        glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr, static_cast<GLsizei>(m_Count));
+    }
+
+    void ParticleEmitter::EndBatch() {
+        if (s_InstanceStream) {
+            s_InstanceStream->EndFrame();
+        }
+    }
+
+} // namespace Effect
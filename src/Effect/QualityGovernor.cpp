@@ -0,0 +1,113 @@
+#include "Effect/QualityGovernor.hpp"
+#include "Effect/EffectManager.hpp"
+#include "Util/Logger.hpp"
+
+namespace Effect {
+
+    namespace {
+        constexpr const char* kTierNames[] = {
+            "FULL",
+            "NO_GLOW",
+            "NO_ANIMATION",
+            "REDUCED_RESOLUTION",
+        };
+        static_assert(std::size(kTierNames) == static_cast<size_t>(QualityTier::COUNT),
+                      "kTierNames must list every QualityTier");
+    }
+
+    const char* QualityGovernor::GetTierName(QualityTier tier) {
+        const auto index = static_cast<size_t>(tier);
+        return index < std::size(kTierNames) ? kTierNames[index] : "UNKNOWN";
+    }
+
+    void QualityGovernor::Update(float deltaTime) {
+        m_Clock += deltaTime;
+        if (!m_Enabled || deltaTime <= 0.0f || deltaTime > kHitchThreshold) return;
+
+        // 固定大小的環狀視窗，維持總和就能算平均
+        if (m_WindowCount == kWindowSize) {
+            m_WindowSum -= m_Window[m_WindowNext];
+        } else {
+            ++m_WindowCount;
+        }
+        m_Window[m_WindowNext] = deltaTime;
+        m_WindowSum += deltaTime;
+        m_WindowNext = (m_WindowNext + 1) % kWindowSize;
+
+        // 視窗填滿才判斷，切換後視窗會清空，所以降級之間至少隔一個視窗
+        if (m_WindowCount < kWindowSize) return;
+
+        const float average = m_WindowSum / static_cast<float>(m_WindowCount);
+        const auto tier = static_cast<size_t>(m_Tier);
+        if (average > m_TargetFrameTime * kDowngradeRatio && tier + 1 < static_cast<size_t>(QualityTier::COUNT)) {
+            // 剛升上來就撐不住：這台機器跟不上這一級，下次要穩定更久才再試
+            if (m_Upgraded && m_Clock - m_TierStart < kFailureWindow && m_Failures[tier] < kMaxFailures) {
+                ++m_Failures[tier];
+                if (m_Failures[tier] == kMaxFailures) {
+                    LOG_INFO("Effect quality {} failed {} times, no longer upgrading to it",
+                             GetTierName(m_Tier), kMaxFailures);
+                }
+            }
+            SwitchTo(static_cast<QualityTier>(tier + 1));
+            return;
+        }
+
+        // 幀率有上限，跟得上時平均就停在目標附近；持續夠久才升一級
+        if (average <= m_TargetFrameTime * kSteadyRatio) {
+            m_SteadyTime += deltaTime;
+        } else {
+            m_SteadyTime = 0.0f;
+        }
+        if (tier == 0) return;
+        const auto next = static_cast<QualityTier>(tier - 1);
+        const float delay = GetUpgradeDelay(next);
+        if (delay >= 0.0f && m_SteadyTime >= delay) {
+            SwitchTo(next);
+            m_Upgraded = true;
+        }
+    }
+
+    float QualityGovernor::GetUpgradeDelay(QualityTier tier) const {
+        const uint8_t failures = m_Failures[static_cast<size_t>(tier)];
+        if (failures >= kMaxFailures) return -1.0f;
+        return kUpgradeDelay * static_cast<float>(1u << failures);
+    }
+
+    float QualityGovernor::GetAverageFrameTimeMs() const {
+        return m_WindowCount == 0 ? 0.0f : m_WindowSum / static_cast<float>(m_WindowCount) * 1000.0f;
+    }
+
+    void QualityGovernor::SetEnabled(bool enabled) {
+        m_Enabled = enabled;
+        if (!enabled && m_Tier != QualityTier::FULL) {
+            SwitchTo(QualityTier::FULL);
+        }
+    }
+
+    void QualityGovernor::ForceTier(QualityTier tier) {
+        if (tier != m_Tier) {
+            SwitchTo(tier);
+        }
+    }
+
+    void QualityGovernor::SwitchTo(QualityTier tier) {
+        const float averageMs = GetAverageFrameTimeMs();
+        LOG_INFO("Effect quality {} -> {} (average frame time {:.2f} ms)",
+                 GetTierName(m_Tier), GetTierName(tier), averageMs);
+
+        m_History.push_back(Switch{m_Clock, m_Tier, tier, averageMs});
+        if (m_History.size() > kMaxHistory) {
+            m_History.pop_front();
+        }
+
+        m_Tier = tier;
+        m_TierStart = m_Clock;
+        m_Upgraded = false;
+        m_SteadyTime = 0.0f;
+        m_WindowCount = 0;
+        m_WindowNext = 0;
+        m_WindowSum = 0.0f;
+        EffectManager::GetInstance().SetQualityTier(tier);
+    }
+
+} // namespace Effect
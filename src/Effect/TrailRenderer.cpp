@@ -0,0 +1,178 @@
+#include "Effect/TrailRenderer.hpp"
+#include "Render/RenderState.hpp"
+#include "Util/Logger.hpp"
+#include "Util/TransformUtils.hpp"
+#include "config.hpp"
+
+namespace Effect {
+
+    namespace {
+        // 串流緩衝區每段的初始容量 (以頂點數計)，不夠時會加倍
+        constexpr size_t kInitialVertexCapacity = 1024;
+
+        // 太近的點 (幾乎沒移動) 會讓切線方向不穩，略過
+        constexpr float kMinSegmentLength = 0.5f;
+    }
+
+    TrailRenderer::TrailRenderer() {
+        InitializeResources();
+    }
+
+    TrailRenderer::~TrailRenderer() = default;
+
+    void TrailRenderer::InitializeResources() {
+        try {
+            m_Program = std::make_unique<Render::ShaderProgram>(
+                GA_RESOURCE_DIR "/shaders/Trail.vert",
+                GA_RESOURCE_DIR "/shaders/Trail.frag");
+            m_Uniforms = std::make_unique<Render::UniformTable>(m_Program->GetId());
+            m_ProjectionUniform = m_Uniforms->Find("u_Projection");
+            LOG_INFO("Trail shaders loaded successfully");
+        } catch (const std::exception& e) {
+            LOG_ERROR("Failed to load trail shaders: {}", e.what());
+            m_Program.reset();
+            return;
+        }
+
+        // 頂點全部來自串流緩衝區，VAO 只記錄屬性格式
+        m_VertexStream = std::make_unique<Render::StreamBuffer>(
+            GL_ARRAY_BUFFER, kInitialVertexCapacity * sizeof(TrailVertex), sizeof(TrailVertex));
+        m_VertexArray = std::make_unique<Core::VertexArray>();
+        m_VertexArray->Bind();
+        glBindBuffer(GL_ARRAY_BUFFER, m_VertexStream->GetId());
+        glEnableVertexAttribArray(0);
+        glEnableVertexAttribArray(1);
+        m_VertexArray->Unbind();
+
+        m_Projection = Util::ConvertToUniformBufferData(Util::Transform{}, {1.0f, 1.0f}, 0.0f).m_Projection;
+    }
+
+    void TrailRenderer::Begin() {
+        for (size_t i = 0; i < m_StripCount; ++i) {
+            m_Strips[i].vertices.clear();
+        }
+        m_StripCount = 0;
+        m_Vertices.clear();
+        m_StreamBegun = false;
+    }
+
+    TrailRenderer::Strip& TrailRenderer::GetStrip(float zIndex) {
+        // 同時存在的 z 只有少數幾種，線性搜尋即可
+        for (size_t i = 0; i < m_StripCount; ++i) {
+            if (m_Strips[i].zIndex == zIndex) return m_Strips[i];
+        }
+        if (m_StripCount == m_Strips.size()) {
+            m_Strips.emplace_back();
+        }
+        Strip& strip = m_Strips[m_StripCount++];
+        strip.zIndex = zIndex;
+        return strip;
+    }
+
+    void TrailRenderer::AddTrail(const TrailHistory& history, const glm::vec2& head, float width,
+                                 const glm::vec4& color, float zIndex) {
+        // 目前位置接上過去的位置，略過重疊的點
+        size_t count = 0;
+        m_Points[count++] = head;
+        for (size_t age = 0; age < history.GetCount(); ++age) {
+            const glm::vec2& point = history.GetPoint(age);
+            if (glm::length(point - m_Points[count - 1]) >= kMinSegmentLength) {
+                m_Points[count++] = point;
+            }
+        }
+        if (count < 2) return;
+
+        // 與同 z 的上一條尾跡之間插入退化三角形 (重複上一條的最後一點與這一條的第一點)
+        std::vector<TrailVertex>& vertices = GetStrip(zIndex).vertices;
+        const bool join = !vertices.empty();
+        if (join) {
+            vertices.push_back(vertices.back());
+        }
+
+        const float last = static_cast<float>(count - 1);
+        glm::vec2 tangent(1.0f, 0.0f);
+        for (size_t i = 0; i < count; ++i) {
+            // 中央差分的切線，兩端用單邊差分 (折返時兩點重合，沿用上一個切線)
+            const glm::vec2& previous = m_Points[i == 0 ? 0 : i - 1];
+            const glm::vec2& next = m_Points[i + 1 < count ? i + 1 : i];
+            const glm::vec2 difference = previous - next;
+            if (glm::length(difference) > 1e-4f) {
+                tangent = glm::normalize(difference);
+            }
+            const glm::vec2 normal(-tangent.y, tangent.x);
+
+            // 越舊越細、越透明
+            const float fade = 1.0f - static_cast<float>(i) / last;
+            const glm::vec2 offset = normal * (width * 0.5f * fade);
+            const glm::vec4 vertexColor(color.r, color.g, color.b, color.a * fade);
+
+            const glm::vec2 left = m_Points[i] + offset;
+            const glm::vec2 right = m_Points[i] - offset;
+            if (join && i == 0) {
+                vertices.push_back(TrailVertex{glm::vec4(left, zIndex, 1.0f), vertexColor});
+            }
+            vertices.push_back(TrailVertex{glm::vec4(left, zIndex, 1.0f), vertexColor});
+            vertices.push_back(TrailVertex{glm::vec4(right, zIndex, -1.0f), vertexColor});
+        }
+    }
+
+    void TrailRenderer::Submit(Render::DrawQueue& queue) {
+        if (m_StripCount == 0 || !m_Program) return;
+
+        // 各 z 的 strip 接成一份頂點，項目的 payload 為 strip 的編號
+        for (size_t i = 0; i < m_StripCount; ++i) {
+            Strip& strip = m_Strips[i];
+            strip.first = m_Vertices.size();
+            m_Vertices.insert(m_Vertices.end(), strip.vertices.begin(), strip.vertices.end());
+            queue.Submit(Render::DrawQueue::MakeKey(strip.zIndex, Render::DrawProgram::TRAIL), this,
+                         static_cast<uint32_t>(i));
+        }
+    }
+
+    void TrailRenderer::DrawRun(const uint32_t* payloads, size_t count) {
+        if (m_Vertices.empty() || !m_Program) return;
+
+        // 第一個項目繪製時上傳整幀的頂點，之後的項目只畫自己的範圍
+        if (!m_StreamBegun) {
+            const size_t bytes = m_Vertices.size() * sizeof(TrailVertex);
+            if (bytes > m_VertexStream->GetFrameCapacity()) {
+                m_VertexStream->Reserve(bytes);
+                LOG_DEBUG("Trail vertex stream grown to {} vertices",
+                          m_VertexStream->GetFrameCapacity() / sizeof(TrailVertex));
+            }
+            m_VertexStream->BeginFrame();
+            m_StreamBegun = true;
+            m_UploadOffset = m_VertexStream->Upload(m_Vertices.data(), bytes);
+        }
+        const size_t offset = m_UploadOffset;
+        if (offset == Render::StreamBuffer::kInvalidOffset) return;
+
+        // 前一段可能是框架的 Image 繪製，已經換掉了綁定
+        auto& state = Render::RenderState::GetInstance();
+        state.InvalidateBindings();
+        state.SetBlend(true);
+        state.SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        state.UseProgram(*m_Program);
+        m_Uniforms->Set(m_ProjectionUniform, m_Projection);
+
+        state.BindVertexArray(*m_VertexArray);
+        glBindBuffer(GL_ARRAY_BUFFER, m_VertexStream->GetId());
+        glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(TrailVertex),
+                              reinterpret_cast<const void*>(offset));
+        glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(TrailVertex),
+                              reinterpret_cast<const void*>(offset + sizeof(glm::vec4)));
+        for (size_t i = 0; i < count; ++i) {
+            const Strip& strip = m_Strips[payloads[i]];
+            glDrawArrays(GL_TRIANGLE_STRIP, static_cast<GLint>(strip.first),
+                         static_cast<GLsizei>(strip.vertices.size()));
+        }
+    }
+
+    void TrailRenderer::EndFrame() {
+        if (m_StreamBegun) {
+            m_VertexStream->EndFrame();
+            m_StreamBegun = false;
+        }
+    }
+
+} // namespace Effect
@@ -4,23 +4,21 @@
 
 // 構造函數，初始化敵人的生命值與繪製屬性
 Enemy::Enemy(std::string name, const float health, const std::vector<std::string>& ImageSet)
-    : Character(ImageSet), m_Name(std::move(name)), m_Health(health), m_MaxHealth(health),
-      m_ColorLocation(-1), m_WidthLocation(-1) {
+    : Character(ImageSet), m_Name(std::move(name)), m_Health(health), m_MaxHealth(health) {
 
     m_Transform.scale = {0.5f, 0.5f};
     SetZIndex(10);
     SetVisible(false);
 
-    // 確保著色程序（Shader Program）只初始化一次
+    // 確保著色程序（Shader Program）與 uniform 表只初始化一次
     if (!s_Program) {
         InitProgram();
+        InitUniforms();
     }
     // 確保頂點數據（Vertex Array）只初始化一次
     if (!s_VertexArray) {
         InitVertexArray();
     }
-    // 初始化 Uniform 變數（著色器中的全域變數）
-    InitUniforms();
 }
 
 // 讓敵人受到傷害，減少生命值
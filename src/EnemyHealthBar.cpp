@@ -1,40 +1,69 @@
 #include "Enemy.hpp"
+#include "Render/DrawQueue.hpp"
+#include "Render/RenderState.hpp"
 
 // 初始化靜態成員：著色程序和頂點數據
-std::unique_ptr<Core::Program> Enemy::s_Program = nullptr;
+std::unique_ptr<Render::ShaderProgram> Enemy::s_Program = nullptr;
 std::unique_ptr<Core::VertexArray> Enemy::s_VertexArray = nullptr;
+std::unique_ptr<Render::UniformTable> Enemy::s_Uniforms = nullptr;
+Render::UniformTable::Id Enemy::s_ColorUniform = Render::UniformTable::kInvalid;
+Render::UniformTable::Id Enemy::s_WidthUniform = Render::UniformTable::kInvalid;
+Render::UniformTable::Id Enemy::s_PositionUniform = Render::UniformTable::kInvalid;
 std::set<float> Enemy::s_HealthBarYPositions; // 定義靜態成員變數
+std::vector<Enemy::HealthBarDraw> Enemy::s_HealthBarDraws;
+
+// 血條的繪製來源：DrawQueue 排序後，同層相鄰的血條一次畫完
+class Enemy::HealthBarSource : public Render::DrawSource {
+public:
+    void DrawRun(const uint32_t* payloads, size_t count) override {
+        if (!s_Program || !s_Uniforms || !s_VertexArray) return;
+
+        // 前一段可能是框架的 Image 繪製，已經換掉了綁定
+        auto& state = Render::RenderState::GetInstance();
+        state.InvalidateBindings();
+        // 啟用透明度混合，以確保血條能夠正確顯示
+        state.SetBlend(true);
+        state.SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+        state.UseProgram(*s_Program);
+        // 設定血條顏色為紅色
+        Util::Color m_Color = Util::Color(1.0, 0.1, 0.1, 0.4);
+        s_Uniforms->Set(s_ColorUniform, glm::vec4(m_Color.r, m_Color.g, m_Color.b, m_Color.a));
+
+        state.Validate(*s_Program); // 確保著色程序運行正常 (僅 debug)
+
+        // 綁定一次，每個敵人只換寬度與位置
+        state.BindVertexArray(*s_VertexArray);
+        for (size_t i = 0; i < count; ++i) {
+            const HealthBarDraw& bar = s_HealthBarDraws[payloads[i]];
+            s_Uniforms->Set(s_WidthUniform, bar.width);
+            s_Uniforms->Set(s_PositionUniform, bar.position);
+            s_VertexArray->DrawTriangles();
+        }
+    }
 
-// 繪製敵人的血條
-void Enemy::DrawHealthBar(const glm::vec2& position) const {
-    if (!s_Program || !s_VertexArray || !this->GetVisibility()) return;
-
-    // 啟用透明度混合，以確保血條能夠正確顯示
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-    s_Program->Bind();
-    // 設定血條顏色為紅色
-    Util::Color m_Color = Util::Color(1.0, 0.1, 0.1, 0.4);
-    glUniform4f(m_ColorLocation, m_Color.r, m_Color.g, m_Color.b, m_Color.a);
+    void EndFrame() override {
+        s_HealthBarDraws.clear();
+    }
+};
 
-    // 根據當前生命值調整血條寬度
-    float currentWidth = m_Health / m_MaxHealth;
-    glUniform1f(glGetUniformLocation(s_Program->GetId(), "u_Width"), currentWidth);
+// 繪製敵人的血條：決定位置後送進繪製佇列，m_Root 更新時依 z 與其他物件一起畫出
+void Enemy::DrawHealthBar(const glm::vec2& position) const {
+    if (!s_Program || !s_Uniforms || !s_VertexArray || !this->GetVisibility()) return;
 
     // 檢查 Y 座標是否已經被使用
     float yPosition = position.y;
     while (s_HealthBarYPositions.find(yPosition) != s_HealthBarYPositions.end()) {
         yPosition -= 0.05f;
     }
-    glUniform2f(glGetUniformLocation(s_Program->GetId(), "u_Position"), position.x, yPosition);
 
-    s_Program->Validate(); // 確保著色程序運行正常
+    static HealthBarSource source;
+    Render::DrawQueue::GetInstance().Submit(
+        Render::DrawQueue::MakeKey(kHealthBarZIndex, Render::DrawProgram::HEALTH_BAR), &source,
+        static_cast<uint32_t>(s_HealthBarDraws.size()));
+    // 根據當前生命值調整血條寬度
+    s_HealthBarDraws.push_back(HealthBarDraw{m_Health / m_MaxHealth, glm::vec2(position.x, yPosition)});
 
-    // 綁定並繪製血條
-    s_VertexArray->Bind();
-    s_VertexArray->DrawTriangles();
-    s_Program->Unbind();
     // 將新的 Y 座標加入集合
     s_HealthBarYPositions.insert(yPosition);
 }
@@ -42,7 +71,7 @@ void Enemy::DrawHealthBar(const glm::vec2& position) const {
 // 初始化著色程序，為血條載入對應的著色器文件
 void Enemy::InitProgram() {
     try {
-        s_Program = std::make_unique<Core::Program>(
+        s_Program = std::make_unique<Render::ShaderProgram>(
             GA_RESOURCE_DIR "/shaders/HealthBar.vert",
             GA_RESOURCE_DIR "/shaders/HealthBar.frag"
         );
@@ -81,16 +110,18 @@ void Enemy::InitVertexArray() {
     }));
 }
 
-// 獲取 Shader Program 中的 Uniform 變數位置
+// 反射 Shader Program 中的 Uniform 變數，只在程序載入後做一次
 void Enemy::InitUniforms() {
     if (!s_Program) return;
 
-    s_Program->Bind();
-    m_ColorLocation = glGetUniformLocation(s_Program->GetId(), "u_Color");
-    m_WidthLocation = glGetUniformLocation(s_Program->GetId(), "u_Width");
+    s_Uniforms = std::make_unique<Render::UniformTable>(s_Program->GetId());
+    s_ColorUniform = s_Uniforms->Find("u_Color");
+    s_WidthUniform = s_Uniforms->Find("u_Width");
+    s_PositionUniform = s_Uniforms->Find("u_Position");
 
     // 檢查 Uniform 變數是否成功獲取
-    if (m_ColorLocation == -1 || m_WidthLocation == -1) {
+    if (s_ColorUniform == Render::UniformTable::kInvalid || s_WidthUniform == Render::UniformTable::kInvalid ||
+        s_PositionUniform == Render::UniformTable::kInvalid) {
         LOG_ERROR("Failed to get uniform locations for HealthBar");
     }
 }
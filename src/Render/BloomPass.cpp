@@ -0,0 +1,104 @@
+#include "Render/BloomPass.hpp"
+#include "Render/RenderState.hpp"
+#include "Util/Logger.hpp"
+#include "config.hpp"
+
+namespace Render {
+
+    BloomPass::BloomPass() {
+        try {
+            m_BlurProgram = std::make_unique<ShaderProgram>(
+                GA_RESOURCE_DIR "/shaders/Fullscreen.vert",
+                GA_RESOURCE_DIR "/shaders/BloomBlur.frag");
+            m_BlurUniforms = std::make_unique<UniformTable>(m_BlurProgram->GetId());
+            m_SourceUniform = m_BlurUniforms->Find("u_Source");
+            m_DirectionUniform = m_BlurUniforms->Find("u_Direction");
+
+            m_CompositeProgram = std::make_unique<ShaderProgram>(
+                GA_RESOURCE_DIR "/shaders/Fullscreen.vert",
+                GA_RESOURCE_DIR "/shaders/BloomComposite.frag");
+            m_CompositeUniforms = std::make_unique<UniformTable>(m_CompositeProgram->GetId());
+            m_BloomUniform = m_CompositeUniforms->Find("u_Bloom");
+            m_IntensityUniform = m_CompositeUniforms->Find("u_Intensity");
+            LOG_INFO("Bloom shaders loaded successfully");
+        } catch (const std::exception& e) {
+            LOG_ERROR("Failed to load bloom shaders: {}", e.what());
+            m_BlurProgram.reset();
+            m_CompositeProgram.reset();
+            return;
+        }
+
+        glGenVertexArrays(1, &m_VertexArray);
+    }
+
+    BloomPass::~BloomPass() {
+        if (m_VertexArray != 0) glDeleteVertexArrays(1, &m_VertexArray);
+    }
+
+    void BloomPass::Resize(GLint width, GLint height) {
+        // 半精度浮點，重疊的發光可以超過 1.0
+        m_Emissive.Create(std::max(width / 2, 1), std::max(height / 2, 1), GL_RGBA16F, GL_HALF_FLOAT);
+        m_BlurTargets[0].Create(std::max(width / 4, 1), std::max(height / 4, 1), GL_RGBA16F, GL_HALF_FLOAT);
+        m_BlurTargets[1].Create(std::max(width / 4, 1), std::max(height / 4, 1), GL_RGBA16F, GL_HALF_FLOAT);
+        m_Width = width;
+        m_Height = height;
+        LOG_DEBUG("Bloom targets resized to {}x{}", width, height);
+    }
+
+    bool BloomPass::BeginEmissive() {
+        if (!m_BlurProgram || !m_CompositeProgram) return false;
+
+        glGetIntegerv(GL_VIEWPORT, m_Viewport);
+        if (m_Viewport[2] != m_Width || m_Viewport[3] != m_Height) {
+            Resize(m_Viewport[2], m_Viewport[3]);
+        }
+
+        m_Emissive.Bind();
+        glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        // 發光量以加法累積
+        auto& state = RenderState::GetInstance();
+        state.SetBlend(true);
+        state.SetBlendFunc(GL_ONE, GL_ONE);
+        return true;
+    }
+
+    void BloomPass::Blur(const RenderTarget& source, const RenderTarget& destination, const glm::vec2& direction) {
+        destination.Bind();
+        RenderState::GetInstance().BindTexture(source.GetTexture(), 0);
+        m_BlurUniforms->Set(m_DirectionUniform, direction);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+
+    void BloomPass::Composite() {
+        auto& state = RenderState::GetInstance();
+        const GLint blurHeight = m_BlurTargets[1].GetHeight();
+
+        // 模糊時直接覆寫
+        state.SetBlend(false);
+        glBindVertexArray(m_VertexArray);
+
+        state.UseProgram(*m_BlurProgram);
+        m_BlurUniforms->Set(m_SourceUniform, 0);
+        // 水平從半解析度縮到四分之一，再垂直
+        Blur(m_Emissive, m_BlurTargets[0], {1.0f / static_cast<float>(m_Emissive.GetWidth()), 0.0f});
+        Blur(m_BlurTargets[0], m_BlurTargets[1], {0.0f, 1.0f / static_cast<float>(blurHeight)});
+
+        // 以加法混合疊回畫面
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glViewport(m_Viewport[0], m_Viewport[1], m_Viewport[2], m_Viewport[3]);
+        state.SetBlend(true);
+        state.SetBlendFunc(GL_ONE, GL_ONE);
+        state.UseProgram(*m_CompositeProgram);
+        m_CompositeUniforms->Set(m_BloomUniform, 0);
+        m_CompositeUniforms->Set(m_IntensityUniform, m_Intensity);
+        state.BindTexture(m_BlurTargets[1].GetTexture(), 0);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+
+        // 空 VAO 不經過狀態快取；混合方式還原成框架使用的 alpha 混合
+        state.InvalidateBindings();
+        state.SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    }
+
+} // namespace Render
@@ -0,0 +1,87 @@
+#include "Render/CoverageMask.hpp"
+#include "Render/RenderState.hpp"
+#include "Util/Logger.hpp"
+#include "config.hpp"
+
+namespace Render {
+
+    CoverageMask::CoverageMask() {
+        try {
+            m_Program = std::make_unique<ShaderProgram>(
+                GA_RESOURCE_DIR "/shaders/Fullscreen.vert",
+                GA_RESOURCE_DIR "/shaders/MaskComposite.frag");
+            m_Uniforms = std::make_unique<UniformTable>(m_Program->GetId());
+            m_MaskUniform = m_Uniforms->Find("u_Mask");
+            m_TexelSizeUniform = m_Uniforms->Find("u_TexelSize");
+            m_FillColorUniform = m_Uniforms->Find("u_FillColor");
+            m_EdgeColorUniform = m_Uniforms->Find("u_EdgeColor");
+            LOG_INFO("Mask composite shaders loaded successfully");
+        } catch (const std::exception& e) {
+            LOG_ERROR("Failed to load mask composite shaders: {}", e.what());
+            m_Program.reset();
+            return;
+        }
+
+        glGenVertexArrays(1, &m_VertexArray);
+    }
+
+    CoverageMask::~CoverageMask() {
+        if (m_VertexArray != 0) glDeleteVertexArrays(1, &m_VertexArray);
+    }
+
+    void CoverageMask::BeginFrame(float scale) {
+        m_Scale = scale;
+        m_Drawn = false;
+    }
+
+    void CoverageMask::Bind() {
+        if (!m_Drawn) {
+            // 第一次繪製時依目前的畫面大小 (重新) 建立貼圖並清空
+            glGetIntegerv(GL_VIEWPORT, m_Viewport);
+            const GLint width = std::max(static_cast<GLint>(static_cast<float>(m_Viewport[2]) * m_Scale), 1);
+            const GLint height = std::max(static_cast<GLint>(static_cast<float>(m_Viewport[3]) * m_Scale), 1);
+            if (width != m_Target.GetWidth() || height != m_Target.GetHeight()) {
+                m_Target.Create(width, height, GL_R8, GL_UNSIGNED_BYTE);
+                LOG_DEBUG("Coverage mask resized to {}x{} ({}x)", width, height, m_Scale);
+            }
+            m_Target.Bind();
+            glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
+            m_Drawn = true;
+        } else {
+            m_Target.Bind();
+        }
+
+        // max 混合不看混合係數；狀態快取不記錄混合方程式，Unbind 時改回相加
+        auto& state = RenderState::GetInstance();
+        state.SetBlend(true);
+        state.SetBlendFunc(GL_ONE, GL_ONE);
+        glBlendEquation(GL_MAX);
+    }
+
+    void CoverageMask::Unbind() {
+        glBlendEquation(GL_FUNC_ADD);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glViewport(m_Viewport[0], m_Viewport[1], m_Viewport[2], m_Viewport[3]);
+        RenderState::GetInstance().SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    }
+
+    void CoverageMask::Composite(const glm::vec4& fillColor, const glm::vec4& edgeColor) {
+        if (!m_Drawn || !m_Program) return;
+
+        auto& state = RenderState::GetInstance();
+        state.UseProgram(*m_Program);
+        m_Uniforms->Set(m_MaskUniform, 0);
+        m_Uniforms->Set(m_TexelSizeUniform, glm::vec2(1.0f / static_cast<float>(m_Target.GetWidth()),
+                                                       1.0f / static_cast<float>(m_Target.GetHeight())));
+        m_Uniforms->Set(m_FillColorUniform, fillColor);
+        m_Uniforms->Set(m_EdgeColorUniform, edgeColor);
+        state.BindTexture(m_Target.GetTexture(), 0);
+        glBindVertexArray(m_VertexArray);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+
+        // 空 VAO 不經過狀態快取
+        state.InvalidateBindings();
+    }
+
+} // namespace Render
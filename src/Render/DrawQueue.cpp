@@ -0,0 +1,91 @@
+#include "Render/DrawQueue.hpp"
+
+#include <cstring>
+
+namespace Render {
+
+    namespace {
+        // 把浮點數轉成依數值大小排序的無號整數 (負數全部位元反轉，正數只翻符號位元)
+        uint32_t SortableFloat(float value) {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+        }
+
+        constexpr size_t kRadixBits = 8;
+        constexpr size_t kBuckets = size_t{1} << kRadixBits;
+        constexpr size_t kPasses = 64 / kRadixBits;
+    }
+
+    uint64_t DrawQueue::MakeKey(float z, DrawProgram program, uint16_t material, DrawBlend blend) {
+        return (static_cast<uint64_t>(SortableFloat(z)) << 32) |
+               (static_cast<uint64_t>(program) << 24) |
+               (static_cast<uint64_t>(material) << 8) |
+               static_cast<uint64_t>(blend);
+    }
+
+    void DrawQueue::Submit(uint64_t key, DrawSource* source, uint32_t payload) {
+        m_Items.push_back(Item{key, source, payload});
+        if (std::find(m_Sources.begin(), m_Sources.end(), source) == m_Sources.end()) {
+            m_Sources.push_back(source);
+        }
+    }
+
+    void DrawQueue::Sort() {
+        // LSD 基數排序，每次 8 位元；所有項目在某個位元組都相同時跳過該趟
+        m_Scratch.resize(m_Items.size());
+        for (size_t pass = 0; pass < kPasses; ++pass) {
+            const size_t shift = pass * kRadixBits;
+
+            std::array<size_t, kBuckets> counts{};
+            for (const auto& item : m_Items) {
+                ++counts[(item.key >> shift) & (kBuckets - 1)];
+            }
+            if (counts[(m_Items.front().key >> shift) & (kBuckets - 1)] == m_Items.size()) {
+                continue;
+            }
+
+            size_t offset = 0;
+            for (auto& count : counts) {
+                const size_t bucketSize = count;
+                count = offset;
+                offset += bucketSize;
+            }
+            for (const auto& item : m_Items) {
+                m_Scratch[counts[(item.key >> shift) & (kBuckets - 1)]++] = item;
+            }
+            m_Items.swap(m_Scratch);
+        }
+    }
+
+    void DrawQueue::Flush() {
+        m_LastItemCount = m_Items.size();
+        m_LastRunCount = 0;
+
+        if (!m_Items.empty()) {
+            Sort();
+
+            // 同一來源的相鄰項目合成一段交給來源一次畫完
+            size_t begin = 0;
+            while (begin < m_Items.size()) {
+                DrawSource* source = m_Items[begin].source;
+                size_t end = begin;
+                m_RunPayloads.clear();
+                while (end < m_Items.size() && m_Items[end].source == source) {
+                    m_RunPayloads.push_back(m_Items[end].payload);
+                    ++end;
+                }
+                source->DrawRun(m_RunPayloads.data(), m_RunPayloads.size());
+                ++m_LastRunCount;
+                begin = end;
+            }
+        }
+
+        for (auto* source : m_Sources) {
+            source->EndFrame();
+        }
+        m_Items.clear();
+        m_Sources.clear();
+    }
+
+} // namespace Render
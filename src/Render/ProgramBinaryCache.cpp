@@ -0,0 +1,157 @@
+#include "Render/ProgramBinaryCache.hpp"
+#include "Util/Logger.hpp"
+#include <cinttypes>
+#include <cstdio>
+#include <filesystem>
+
+namespace Render {
+
+    namespace {
+        // 快取檔案的開頭；格式改變時把 kVersion 加一，舊檔案會被視為不符
+        struct FileHeader {
+            uint32_t magic = 0;
+            uint32_t version = 0;
+            uint64_t driverHash = 0;
+            uint32_t format = 0;
+            uint32_t length = 0;
+        };
+        constexpr uint32_t kMagic = 0x42505247;  // "GRPB"
+        constexpr uint32_t kVersion = 1;
+
+        constexpr uint64_t kFnvOffset = 14695981039346656037ull;
+        constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+        std::string GetString(GLenum name) {
+            const auto* text = reinterpret_cast<const char*>(glGetString(name));
+            return text ? text : "";
+        }
+    }
+
+    void ProgramBinaryCache::SetDirectory(const std::string& directory) {
+        GLint formatCount = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+        if (formatCount <= 0) {
+            LOG_INFO("Program binary cache disabled: driver reports no binary formats");
+            m_Enabled = false;
+            return;
+        }
+
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+        if (error) {
+            LOG_ERROR("Failed to create shader cache directory {}: {}", directory, error.message());
+            m_Enabled = false;
+            return;
+        }
+
+        // 驅動換了 (或更新了) 二進位就不能用
+        const std::string driver = GetString(GL_VENDOR) + "|" + GetString(GL_RENDERER) + "|" + GetString(GL_VERSION);
+        m_DriverHash = Hash(driver, kFnvOffset);
+        m_Directory = directory;
+        m_Enabled = true;
+        LOG_INFO("Program binary cache: {} ({})", directory, driver);
+    }
+
+    uint64_t ProgramBinaryCache::MakeKey(const std::string& source) const {
+        return Hash(source, m_DriverHash);
+    }
+
+    uint64_t ProgramBinaryCache::Hash(const std::string& text, uint64_t seed) {
+        // FNV-1a
+        uint64_t hash = seed;
+        for (unsigned char c : text) {
+            hash ^= c;
+            hash *= kFnvPrime;
+        }
+        return hash;
+    }
+
+    std::string ProgramBinaryCache::GetPath(uint64_t key) const {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016" PRIx64 ".bin", key);
+        return m_Directory + "/" + name;
+    }
+
+    bool ProgramBinaryCache::Load(GLuint program, uint64_t key) {
+        if (!m_Enabled) {
+            ++m_Misses;
+            return false;
+        }
+
+        const std::string path = GetPath(key);
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            ++m_Misses;
+            return false;
+        }
+
+        // 長度來自檔案，先與實際大小比對再配置 (截斷或損壞的檔案視為過期)
+        std::error_code sizeError;
+        const uintmax_t fileSize = std::filesystem::file_size(path, sizeError);
+        const uintmax_t payloadSize = !sizeError && fileSize > sizeof(FileHeader) ? fileSize - sizeof(FileHeader) : 0;
+
+        FileHeader header;
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        std::vector<char> binary;
+        if (file && header.magic == kMagic && header.version == kVersion && header.driverHash == m_DriverHash &&
+            header.length > 0 && header.length == payloadSize) {
+            binary.resize(header.length);
+            file.read(binary.data(), static_cast<std::streamsize>(binary.size()));
+        }
+        file.close();
+
+        bool loaded = false;
+        if (!binary.empty() && file) {
+            glProgramBinary(program, header.format, binary.data(), static_cast<GLsizei>(binary.size()));
+            GLint status = GL_FALSE;
+            glGetProgramiv(program, GL_LINK_STATUS, &status);
+            loaded = status == GL_TRUE;
+        }
+
+        if (!loaded) {
+            // 舊版本或驅動拒絕的檔案，刪掉讓這次編譯的結果覆寫
+            LOG_INFO("Discarding stale program binary {}", path);
+            std::error_code error;
+            std::filesystem::remove(path, error);
+            ++m_Misses;
+            return false;
+        }
+        ++m_Hits;
+        return true;
+    }
+
+    void ProgramBinaryCache::Store(GLuint program, uint64_t key) const {
+        if (!m_Enabled) return;
+
+        GLint length = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+        if (length <= 0) return;
+
+        std::vector<char> binary(static_cast<size_t>(length));
+        GLenum format = 0;
+        glGetProgramBinary(program, length, nullptr, &format, binary.data());
+
+        FileHeader header;
+        header.magic = kMagic;
+        header.version = kVersion;
+        header.driverHash = m_DriverHash;
+        header.format = format;
+        header.length = static_cast<uint32_t>(length);
+
+        const std::string path = GetPath(key);
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            LOG_ERROR("Failed to write program binary {}", path);
+            return;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(binary.data(), static_cast<std::streamsize>(binary.size()));
+    }
+
+    void ProgramBinaryCache::PrepareForLink(GLuint program) const {
+        if (m_Enabled) {
+            glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        }
+    }
+
+} // namespace Render
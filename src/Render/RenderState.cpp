@@ -0,0 +1,91 @@
+#include "Render/RenderState.hpp"
+#include "Util/Logger.hpp"
+
+namespace Render {
+
+    void RenderState::BeginFrame() {
+        m_LastIssued = m_Issued;
+        m_LastElided = m_Elided;
+        m_Issued = 0;
+        m_Elided = 0;
+
+        InvalidateBindings();
+        m_Blend = -1;
+        m_BlendFunc = MakeUnknownBlendFunc();
+    }
+
+    void RenderState::InvalidateBindings() {
+        // 混合狀態只在初始化時由框架設定，之後只有我們會改，所以不用清除
+        m_Program = kUnknown;
+        m_VertexArray = nullptr;
+        m_ActiveUnit = kUnknown;
+        m_Textures = MakeUnknownTextures();
+    }
+
+    void RenderState::UseProgram(const ShaderProgram& program) {
+        if (Change(m_Program, program.GetId())) {
+            program.Bind();
+        }
+    }
+
+    void RenderState::UseProgram(GLuint program) {
+        if (Change(m_Program, program)) {
+            glUseProgram(program);
+        }
+    }
+
+    void RenderState::BindVertexArray(const Core::VertexArray& vertexArray) {
+        if (Change(m_VertexArray, &vertexArray)) {
+            vertexArray.Bind();
+        }
+    }
+
+    void RenderState::BindTexture(GLuint texture, GLuint unit) {
+        if (unit >= kTextureUnits) {
+            LOG_ERROR("Texture unit {} out of range", unit);
+            return;
+        }
+        if (m_Textures[unit] == texture) {
+            ++m_Elided;
+            return;
+        }
+        if (Change(m_ActiveUnit, unit)) {
+            glActiveTexture(GL_TEXTURE0 + unit);
+        }
+        m_Textures[unit] = texture;
+        ++m_Issued;
+        glBindTexture(GL_TEXTURE_2D, texture);
+    }
+
+    void RenderState::SetBlend(bool enabled) {
+        if (Change(m_Blend, enabled ? 1 : 0)) {
+            if (enabled) {
+                glEnable(GL_BLEND);
+            } else {
+                glDisable(GL_BLEND);
+            }
+        }
+    }
+
+    void RenderState::SetBlendFunc(GLenum source, GLenum destination) {
+        if (Change(m_BlendFunc, std::array<GLenum, 4>{source, destination, source, destination})) {
+            glBlendFunc(source, destination);
+        }
+    }
+
+    void RenderState::SetBlendFuncSeparate(GLenum sourceColor, GLenum destinationColor,
+                                           GLenum sourceAlpha, GLenum destinationAlpha) {
+        if (Change(m_BlendFunc, std::array<GLenum, 4>{sourceColor, destinationColor, sourceAlpha, destinationAlpha})) {
+            glBlendFuncSeparate(sourceColor, destinationColor, sourceAlpha, destinationAlpha);
+        }
+    }
+
+    void RenderState::Validate(const ShaderProgram& program) const {
+#ifndef NDEBUG
+        program.Validate();
+#else
+        (void) program;
+#endif
+    }
+
+} // namespace Render
@@ -0,0 +1,47 @@
+#include "Render/RenderTarget.hpp"
+#include "Render/RenderState.hpp"
+#include "Util/Logger.hpp"
+
+namespace Render {
+
+    void RenderTarget::Create(GLint width, GLint height, GLenum internalFormat, GLenum type) {
+        Destroy();
+
+        glGenTextures(1, &m_Texture);
+        glBindTexture(GL_TEXTURE_2D, m_Texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(internalFormat), width, height, 0, GL_RGBA, type, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        glGenFramebuffers(1, &m_Framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, m_Framebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_Texture, 0);
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+            LOG_ERROR("Framebuffer {}x{} is incomplete", width, height);
+        }
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        m_Width = width;
+        m_Height = height;
+
+        // 直接綁過貼圖，狀態快取要重來
+        RenderState::GetInstance().InvalidateBindings();
+    }
+
+    void RenderTarget::Destroy() {
+        if (m_Framebuffer != 0) glDeleteFramebuffers(1, &m_Framebuffer);
+        if (m_Texture != 0) glDeleteTextures(1, &m_Texture);
+        m_Framebuffer = 0;
+        m_Texture = 0;
+        m_Width = 0;
+        m_Height = 0;
+    }
+
+    void RenderTarget::Bind() const {
+        glBindFramebuffer(GL_FRAMEBUFFER, m_Framebuffer);
+        glViewport(0, 0, m_Width, m_Height);
+    }
+
+} // namespace Render
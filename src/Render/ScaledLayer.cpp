@@ -0,0 +1,81 @@
+#include "Render/ScaledLayer.hpp"
+#include "Render/RenderState.hpp"
+#include "Util/Logger.hpp"
+#include "config.hpp"
+
+namespace Render {
+
+    ScaledLayer::ScaledLayer() {
+        try {
+            m_Program = std::make_unique<ShaderProgram>(
+                GA_RESOURCE_DIR "/shaders/Fullscreen.vert",
+                GA_RESOURCE_DIR "/shaders/LayerComposite.frag");
+            m_Uniforms = std::make_unique<UniformTable>(m_Program->GetId());
+            m_LayerUniform = m_Uniforms->Find("u_Layer");
+            LOG_INFO("Layer composite shaders loaded successfully");
+        } catch (const std::exception& e) {
+            LOG_ERROR("Failed to load layer composite shaders: {}", e.what());
+            m_Program.reset();
+            return;
+        }
+
+        glGenVertexArrays(1, &m_VertexArray);
+    }
+
+    ScaledLayer::~ScaledLayer() {
+        if (m_VertexArray != 0) glDeleteVertexArrays(1, &m_VertexArray);
+    }
+
+    void ScaledLayer::BeginFrame(float scale) {
+        m_Scale = scale;
+        m_Drawn = false;
+    }
+
+    void ScaledLayer::Bind() {
+        if (!m_Drawn) {
+            // 第一次繪製時依目前的畫面大小 (重新) 建立貼圖並清空
+            glGetIntegerv(GL_VIEWPORT, m_Viewport);
+            const GLint width = std::max(static_cast<GLint>(static_cast<float>(m_Viewport[2]) * m_Scale), 1);
+            const GLint height = std::max(static_cast<GLint>(static_cast<float>(m_Viewport[3]) * m_Scale), 1);
+            if (width != m_Target.GetWidth() || height != m_Target.GetHeight()) {
+                m_Target.Create(width, height, GL_RGBA8, GL_UNSIGNED_BYTE);
+                LOG_DEBUG("Scaled layer resized to {}x{} ({}x)", width, height, m_Scale);
+            }
+            m_Target.Bind();
+            glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
+            m_Drawn = true;
+        } else {
+            m_Target.Bind();
+        }
+
+        // 顏色乘上 alpha 後累積，alpha 以 over 運算累積，結果是預乘 alpha
+        auto& state = RenderState::GetInstance();
+        state.SetBlend(true);
+        state.SetBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    }
+
+    void ScaledLayer::Unbind() {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glViewport(m_Viewport[0], m_Viewport[1], m_Viewport[2], m_Viewport[3]);
+        RenderState::GetInstance().SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    }
+
+    void ScaledLayer::Composite() {
+        if (!m_Drawn || !m_Program) return;
+
+        auto& state = RenderState::GetInstance();
+        state.SetBlend(true);
+        state.SetBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+        state.UseProgram(*m_Program);
+        m_Uniforms->Set(m_LayerUniform, 0);
+        state.BindTexture(m_Target.GetTexture(), 0);
+        glBindVertexArray(m_VertexArray);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+
+        // 空 VAO 不經過狀態快取；混合方式還原成框架使用的 alpha 混合
+        state.InvalidateBindings();
+        state.SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    }
+
+} // namespace Render
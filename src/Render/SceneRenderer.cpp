@@ -0,0 +1,59 @@
+#include "Render/SceneRenderer.hpp"
+
+namespace Render {
+
+    void SceneRenderer::AddChild(const std::shared_ptr<Util::GameObject>& child) {
+        m_Children.push_back(child);
+    }
+
+    void SceneRenderer::AddChildren(const std::vector<std::shared_ptr<Util::GameObject>>& children) {
+        m_Children.reserve(m_Children.size() + children.size());
+        m_Children.insert(m_Children.end(), children.begin(), children.end());
+    }
+
+    void SceneRenderer::RemoveChild(const std::shared_ptr<Util::GameObject>& child) {
+        m_Children.erase(std::remove(m_Children.begin(), m_Children.end(), child), m_Children.end());
+    }
+
+    void SceneRenderer::AddSource(SceneSource* source) {
+        if (std::find(m_Sources.begin(), m_Sources.end(), source) == m_Sources.end()) {
+            m_Sources.push_back(source);
+        }
+    }
+
+    void SceneRenderer::Update() {
+        auto& queue = DrawQueue::GetInstance();
+
+        // 與 Util::Renderer 相同：走訪整棵樹，每個物件依自己的 z 排序
+        m_FrameObjects.clear();
+        m_Stack.clear();
+        for (const auto& child : m_Children) {
+            m_Stack.push_back(child.get());
+        }
+        while (!m_Stack.empty()) {
+            Util::GameObject* object = m_Stack.back();
+            m_Stack.pop_back();
+
+            queue.Submit(DrawQueue::MakeKey(object->GetZIndex(), DrawProgram::SPRITE), this,
+                         static_cast<uint32_t>(m_FrameObjects.size()));
+            m_FrameObjects.push_back(object);
+
+            for (const auto& child : object->GetChildren()) {
+                m_Stack.push_back(child.get());
+            }
+        }
+
+        for (auto* source : m_Sources) {
+            source->Submit(queue);
+        }
+
+        queue.Flush();
+    }
+
+    void SceneRenderer::DrawRun(const uint32_t* payloads, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            m_FrameObjects[payloads[i]]->Draw();
+        }
+    }
+
+} // namespace Render
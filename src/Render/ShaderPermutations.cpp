@@ -0,0 +1,32 @@
+#include "Render/ShaderPermutations.hpp"
+#include "Util/Logger.hpp"
+
+namespace Render {
+
+    ShaderPermutations::ShaderPermutations(const std::string& vertexPath, const std::string& fragmentPath) {
+        try {
+            m_Vertex = ShaderSource::FromFile(vertexPath);
+            m_Fragment = ShaderSource::FromFile(fragmentPath);
+        } catch (const std::exception& e) {
+            LOG_ERROR("{}", e.what());
+        }
+    }
+
+    GLuint ShaderPermutations::Get(uint32_t key, const std::string& defines) {
+        auto it = m_Programs.find(key);
+        if (it != m_Programs.end()) return it->second ? it->second->GetId() : 0;
+
+        std::unique_ptr<ShaderProgram> program;
+        try {
+            program = std::make_unique<ShaderProgram>(m_Vertex, m_Fragment, defines);
+            LOG_DEBUG("Shader variant {} {} ({} variants)", key,
+                      program->IsFromCache() ? "loaded from cache" : "compiled", m_Programs.size() + 1);
+        } catch (const std::exception& e) {
+            LOG_ERROR("Failed to compile shader variant {}: {}", key, e.what());
+        }
+        const GLuint id = program ? program->GetId() : 0;
+        m_Programs.emplace(key, std::move(program));
+        return id;
+    }
+
+} // namespace Render
@@ -0,0 +1,120 @@
+#include "Render/ShaderProgram.hpp"
+#include "Render/ProgramBinaryCache.hpp"
+#include "Util/Logger.hpp"
+
+namespace Render {
+
+    ShaderSource ShaderSource::FromFile(const std::string& path) {
+        std::ifstream file(path);
+        if (!file) {
+            throw std::runtime_error("Failed to open shader: " + path);
+        }
+        std::stringstream stream;
+        stream << file.rdbuf();
+        return {path, stream.str()};
+    }
+
+    ShaderProgram::ShaderProgram(const std::string& vertexPath, const std::string& fragmentPath)
+        : ShaderProgram(ShaderSource::FromFile(vertexPath), ShaderSource::FromFile(fragmentPath)) {
+    }
+
+    ShaderProgram::ShaderProgram(const ShaderSource& vertex, const ShaderSource& fragment,
+                                 const std::string& defines) {
+        m_Id = glCreateProgram();
+
+        auto& cache = ProgramBinaryCache::GetInstance();
+        const uint64_t key = cache.MakeKey(vertex.text + '\0' + fragment.text + '\0' + defines);
+        if (cache.Load(m_Id, key)) {
+            m_FromCache = true;
+            return;
+        }
+
+        try {
+            Link(vertex, fragment, defines);
+        } catch (...) {
+            glDeleteProgram(m_Id);
+            m_Id = 0;
+            throw;
+        }
+        cache.Store(m_Id, key);
+    }
+
+    ShaderProgram::~ShaderProgram() {
+        if (m_Id != 0) glDeleteProgram(m_Id);
+    }
+
+    void ShaderProgram::Validate() const {
+        glValidateProgram(m_Id);
+        GLint status = GL_FALSE;
+        glGetProgramiv(m_Id, GL_VALIDATE_STATUS, &status);
+        if (status != GL_TRUE) {
+            GLint length = 0;
+            glGetProgramiv(m_Id, GL_INFO_LOG_LENGTH, &length);
+            std::string log(static_cast<size_t>(std::max(length, 1)), '\0');
+            glGetProgramInfoLog(m_Id, length, nullptr, log.data());
+            LOG_ERROR("Validation failed for program {}: {}", m_Id, log);
+        }
+    }
+
+    GLuint ShaderProgram::CompileShader(GLenum type, const ShaderSource& source, const std::string& defines) {
+        // #version 必須在最前面，定義插在它之後；#line 讓錯誤訊息的行號對回原始檔
+        std::string version;
+        std::string body = source.text;
+        if (source.text.compare(0, 8, "#version") == 0) {
+            const size_t end = source.text.find('\n');
+            version = source.text.substr(0, end == std::string::npos ? source.text.size() : end + 1);
+            body = end == std::string::npos ? std::string{} : source.text.substr(end + 1);
+        }
+        const std::string lineDirective = "#line 2\n";
+        const char* sources[] = {version.c_str(), defines.c_str(), lineDirective.c_str(), body.c_str()};
+
+        const GLuint shader = glCreateShader(type);
+        glShaderSource(shader, 4, sources, nullptr);
+        glCompileShader(shader);
+
+        GLint status = GL_FALSE;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+        if (status != GL_TRUE) {
+            GLint length = 0;
+            glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &length);
+            std::string log(static_cast<size_t>(std::max(length, 1)), '\0');
+            glGetShaderInfoLog(shader, length, nullptr, log.data());
+            glDeleteShader(shader);
+            throw std::runtime_error(source.path + ": " + log);
+        }
+        return shader;
+    }
+
+    void ShaderProgram::Link(const ShaderSource& vertex, const ShaderSource& fragment, const std::string& defines) {
+        const GLuint vertexShader = CompileShader(GL_VERTEX_SHADER, vertex, defines);
+        GLuint fragmentShader = 0;
+        try {
+            fragmentShader = CompileShader(GL_FRAGMENT_SHADER, fragment, defines);
+        } catch (...) {
+            glDeleteShader(vertexShader);
+            throw;
+        }
+
+        ProgramBinaryCache::GetInstance().PrepareForLink(m_Id);
+        glAttachShader(m_Id, vertexShader);
+        glAttachShader(m_Id, fragmentShader);
+        glLinkProgram(m_Id);
+
+        // 連結後 shader 物件就不需要了
+        glDetachShader(m_Id, vertexShader);
+        glDetachShader(m_Id, fragmentShader);
+        glDeleteShader(vertexShader);
+        glDeleteShader(fragmentShader);
+
+        GLint status = GL_FALSE;
+        glGetProgramiv(m_Id, GL_LINK_STATUS, &status);
+        if (status != GL_TRUE) {
+            GLint length = 0;
+            glGetProgramiv(m_Id, GL_INFO_LOG_LENGTH, &length);
+            std::string log(static_cast<size_t>(std::max(length, 1)), '\0');
+            glGetProgramInfoLog(m_Id, length, nullptr, log.data());
+            throw std::runtime_error(vertex.path + " + " + fragment.path + ": link failed: " + log);
+        }
+    }
+
+} // namespace Render
@@ -0,0 +1,112 @@
+#include "Render/StreamBuffer.hpp"
+#include "Util/Logger.hpp"
+
+#include <cstring>
+
+namespace Render {
+
+    namespace {
+        size_t AlignUp(size_t value, size_t alignment) {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        // 等一幀的 GPU 時間已經很多了，再久就放棄等待並記錄
+        constexpr GLuint64 kFenceTimeoutNs = 100'000'000;
+    }
+
+    StreamBuffer::StreamBuffer(GLenum target, size_t frameCapacity, size_t alignment)
+        : m_Target(target),
+          m_Alignment(std::max<size_t>(alignment, 1)),
+          m_FrameCapacity(AlignUp(std::max<size_t>(frameCapacity, 1), m_Alignment)) {
+        Allocate();
+    }
+
+    StreamBuffer::~StreamBuffer() {
+        ReleaseFences();
+        if (m_Buffer != 0) {
+            glDeleteBuffers(1, &m_Buffer);
+        }
+    }
+
+    void StreamBuffer::Allocate() {
+        if (m_Buffer == 0) {
+            glGenBuffers(1, &m_Buffer);
+        }
+        glBindBuffer(m_Target, m_Buffer);
+        glBufferData(m_Target, static_cast<GLsizeiptr>(m_FrameCapacity * kFramesInFlight), nullptr, GL_STREAM_DRAW);
+        LOG_DEBUG("Stream buffer allocated: {} bytes x {} frames", m_FrameCapacity, kFramesInFlight);
+    }
+
+    void StreamBuffer::ReleaseFences() {
+        for (auto& fence : m_Fences) {
+            if (fence) {
+                glDeleteSync(fence);
+                fence = nullptr;
+            }
+        }
+    }
+
+    void StreamBuffer::Reserve(size_t bytes) {
+        if (bytes <= m_FrameCapacity) return;
+
+        // 容量加倍，重新配置整個 buffer；舊的儲存空間由驅動在 GPU 用完後回收
+        m_FrameCapacity = AlignUp(std::max(bytes, m_FrameCapacity * 2), m_Alignment);
+        ReleaseFences();
+        Allocate();
+        m_Segment = 0;
+        m_Cursor = 0;
+    }
+
+    void StreamBuffer::BeginFrame() {
+        m_Segment = (m_Segment + 1) % kFramesInFlight;
+        m_Cursor = 0;
+
+        GLsync& fence = m_Fences[m_Segment];
+        if (!fence) return;
+
+        // 先不 flush 試一次，大多數情況 GPU 早就讀完了
+        GLenum result = glClientWaitSync(fence, 0, 0);
+        if (result == GL_TIMEOUT_EXPIRED) {
+            ++m_StallCount;
+            result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, kFenceTimeoutNs);
+        }
+        if (result == GL_WAIT_FAILED) {
+            LOG_ERROR("Stream buffer fence wait failed");
+        }
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+
+    size_t StreamBuffer::Upload(const void* data, size_t bytes) {
+        const size_t size = AlignUp(bytes, m_Alignment);
+        if (m_Cursor + size > m_FrameCapacity) {
+            LOG_ERROR("Stream buffer overflow: {} + {} > {}", m_Cursor, size, m_FrameCapacity);
+            return kInvalidOffset;
+        }
+
+        const size_t offset = m_Segment * m_FrameCapacity + m_Cursor;
+        glBindBuffer(m_Target, m_Buffer);
+        void* dst = glMapBufferRange(m_Target, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(bytes),
+            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+        if (!dst) {
+            LOG_ERROR("Failed to map stream buffer range");
+            return kInvalidOffset;
+        }
+        std::memcpy(dst, data, bytes);
+        glUnmapBuffer(m_Target);
+
+        m_Cursor += size;
+        return offset;
+    }
+
+    void StreamBuffer::EndFrame() {
+        if (m_Cursor == 0) return;
+
+        GLsync& fence = m_Fences[m_Segment];
+        if (fence) {
+            glDeleteSync(fence);
+        }
+        fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+} // namespace Render
@@ -0,0 +1,112 @@
+#include "Render/TextureAtlas.hpp"
+#include "Util/Logger.hpp"
+
+namespace Render {
+
+    TextureAtlas::TextureAtlas(GLint size)
+        : m_Size(size) {
+        m_Target.Create(size, size, GL_RGBA8, GL_UNSIGNED_BYTE);
+    }
+
+    const glm::vec4* TextureAtlas::Find(uint64_t key) {
+        const auto it = m_Entries.find(key);
+        if (it == m_Entries.end()) return nullptr;
+        it->second.lastUsed = m_Frame;
+        return &it->second.uvRect;
+    }
+
+    bool TextureAtlas::Allocate(GLint width, GLint height, Region& region) {
+        if (width + 2 * kPadding > m_Size || height + 2 * kPadding > m_Size) return false;
+        if (!m_ShelfFull && AllocateShelf(width, height, region)) return true;
+        if (AllocateFree(width, height, region)) return true;
+
+        // 回收清單也放不下時才掃描久未使用的項目 (一幀最多一次)
+        if (m_EvictFrame == m_Frame) return false;
+        m_EvictFrame = m_Frame;
+        const size_t evicted = EvictStale();
+        if (evicted > 0) {
+            LOG_DEBUG("Texture atlas evicted {} stale entries, {} remain", evicted, m_Entries.size());
+        }
+        return evicted > 0 && AllocateFree(width, height, region);
+    }
+
+    bool TextureAtlas::AllocateShelf(GLint width, GLint height, Region& region) {
+        const GLint paddedWidth = width + 2 * kPadding;
+        const GLint paddedHeight = height + 2 * kPadding;
+
+        // 這一層放不下就開新的一層
+        if (m_ShelfX + paddedWidth > m_Size) {
+            m_ShelfY += m_ShelfHeight;
+            m_ShelfX = 0;
+            m_ShelfHeight = 0;
+        }
+        if (m_ShelfY + paddedHeight > m_Size) {
+            m_ShelfFull = true;
+            return false;
+        }
+
+        region = Region{m_ShelfX + kPadding, m_ShelfY + kPadding, width, height, width, height};
+        m_ShelfX += paddedWidth;
+        m_ShelfHeight = std::max(m_ShelfHeight, paddedHeight);
+        return true;
+    }
+
+    bool TextureAtlas::AllocateFree(GLint width, GLint height, Region& region) {
+        auto best = m_FreeRegions.end();
+        for (auto it = m_FreeRegions.begin(); it != m_FreeRegions.end(); ++it) {
+            if (it->slotWidth < width || it->slotHeight < height) continue;
+            if (best == m_FreeRegions.end() ||
+                it->slotWidth * it->slotHeight < best->slotWidth * best->slotHeight) {
+                best = it;
+            }
+        }
+        if (best == m_FreeRegions.end()) return false;
+
+        region = *best;
+        region.width = width;
+        region.height = height;
+        *best = m_FreeRegions.back();
+        m_FreeRegions.pop_back();
+        return true;
+    }
+
+    size_t TextureAtlas::EvictStale() {
+        size_t evicted = 0;
+        for (auto it = m_Entries.begin(); it != m_Entries.end();) {
+            if (m_Frame - it->second.lastUsed > kStaleFrames) {
+                m_FreeRegions.push_back(it->second.region);
+                it = m_Entries.erase(it);
+                ++evicted;
+            } else {
+                ++it;
+            }
+        }
+        return evicted;
+    }
+
+    void TextureAtlas::BeginRegion(const Region& region) const {
+        m_Target.Bind();
+        glEnable(GL_SCISSOR_TEST);
+        // 清空整個佔用範圍，重用的區塊不會留下前一個外觀
+        glScissor(region.x - kPadding, region.y - kPadding,
+                  region.slotWidth + 2 * kPadding, region.slotHeight + 2 * kPadding);
+        glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+    }
+
+    void TextureAtlas::EndRegion() const {
+        glDisable(GL_SCISSOR_TEST);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+
+    const glm::vec4& TextureAtlas::Insert(uint64_t key, const Region& region) {
+        const float size = static_cast<float>(m_Size);
+        const glm::vec4 uvRect(static_cast<float>(region.x) / size, static_cast<float>(region.y) / size,
+                               static_cast<float>(region.x + region.width) / size,
+                               static_cast<float>(region.y + region.height) / size);
+        Entry& entry = m_Entries[key];
+        entry = Entry{uvRect, region, m_Frame};
+        return entry.uvRect;
+    }
+
+} // namespace Render
@@ -0,0 +1,109 @@
+#include "Render/UniformTable.hpp"
+#include "Util/Logger.hpp"
+#include <cstring>
+#include <glm/gtc/type_ptr.hpp>
+
+namespace Render {
+
+    UniformTable::UniformTable(GLuint program)
+        : m_Program(program) {
+        GLint count = 0;
+        GLint maxLength = 0;
+        glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &count);
+        glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+        std::vector<char> nameBuffer(static_cast<size_t>(std::max(maxLength, 1)));
+        m_Entries.reserve(static_cast<size_t>(count));
+
+        for (GLint i = 0; i < count; ++i) {
+            GLsizei length = 0;
+            GLint size = 0;
+            GLenum type = 0;
+            glGetActiveUniform(program, static_cast<GLuint>(i), static_cast<GLsizei>(nameBuffer.size()),
+                               &length, &size, &type, nameBuffer.data());
+
+            Entry entry;
+            entry.name.assign(nameBuffer.data(), static_cast<size_t>(length));
+            entry.location = glGetUniformLocation(program, entry.name.c_str());
+
+            // uniform block 的成員沒有位置，由 UniformBuffer 處理
+            if (entry.location == -1) continue;
+
+            // 陣列回報為 "u_Name[0]"，統一存成不帶索引的名稱
+            const auto bracket = entry.name.find('[');
+            if (bracket != std::string::npos) {
+                entry.name.erase(bracket);
+            }
+
+            m_Entries.push_back(std::move(entry));
+        }
+
+        LOG_DEBUG("Uniform table for program {} reflected {} uniforms", program, m_Entries.size());
+    }
+
+    UniformTable::Id UniformTable::Find(const std::string& name) const {
+        std::string key = name;
+        const auto bracket = key.find('[');
+        if (bracket != std::string::npos) {
+            key.erase(bracket);
+        }
+
+        for (size_t i = 0; i < m_Entries.size(); ++i) {
+            if (m_Entries[i].name == key) {
+                return static_cast<Id>(i);
+            }
+        }
+
+        // 未使用的 uniform 會被編譯器移除，這不一定是錯誤
+        LOG_WARN("Uniform {} is not active in program {}", name, m_Program);
+        return kInvalid;
+    }
+
+    bool UniformTable::Changed(Id id, const void* data, size_t bytes) {
+        Entry& entry = m_Entries[static_cast<size_t>(id)];
+        if (entry.hasValue && std::memcmp(entry.value.data(), data, bytes) == 0) {
+            ++m_SkippedCount;
+            return false;
+        }
+
+        std::memcpy(entry.value.data(), data, bytes);
+        entry.hasValue = true;
+        ++m_UploadCount;
+        return true;
+    }
+
+    void UniformTable::Set(Id id, int value) {
+        if (id == kInvalid || !Changed(id, &value, sizeof(value))) return;
+        glUniform1i(m_Entries[static_cast<size_t>(id)].location, value);
+    }
+
+    void UniformTable::Set(Id id, float value) {
+        if (id == kInvalid || !Changed(id, &value, sizeof(value))) return;
+        glUniform1f(m_Entries[static_cast<size_t>(id)].location, value);
+    }
+
+    void UniformTable::Set(Id id, const glm::vec2& value) {
+        const float data[2] = {value.x, value.y};
+        if (id == kInvalid || !Changed(id, data, sizeof(data))) return;
+        glUniform2fv(m_Entries[static_cast<size_t>(id)].location, 1, data);
+    }
+
+    void UniformTable::Set(Id id, const glm::vec4& value) {
+        const float data[4] = {value.x, value.y, value.z, value.w};
+        if (id == kInvalid || !Changed(id, data, sizeof(data))) return;
+        glUniform4fv(m_Entries[static_cast<size_t>(id)].location, 1, data);
+    }
+
+    void UniformTable::Set(Id id, const glm::mat4& value) {
+        const float* data = glm::value_ptr(value);
+        if (id == kInvalid || !Changed(id, data, sizeof(float) * 16)) return;
+        glUniformMatrix4fv(m_Entries[static_cast<size_t>(id)].location, 1, GL_FALSE, data);
+    }
+
+    void UniformTable::Invalidate() {
+        for (auto& entry : m_Entries) {
+            entry.hasValue = false;
+        }
+    }
+
+} // namespace Render
@@ -35,12 +35,14 @@ void Skill::Play(const glm::vec2& position, float direction) {
             default: effectType = Effect::EffectType::SKILL_Z; break;
         }
 
-        auto effect = Effect::EffectManager::GetInstance().GetEffect(effectType);
+        auto& effects = Effect::EffectManager::GetInstance();
+        auto handle = effects.GetEffect(effectType);
+        auto effect = effects.Resolve(handle);
         // LOG_DEBUG("get: {}", (effect ? "success" : "fail"));
         effect->SetDuration(static_cast<float>(m_Duration) / 300.0f);
         if (m_SkillId == 2) effect->SetDirection(direction);
         effect->Play(position, 45.0f);
-        m_CurrentEffect = effect;
+        m_CurrentEffect = handle;
     } else if (m_IsOnCooldown) {
         LOG_DEBUG("Skill {} is on cooldown for {:.1f} seconds",
                  m_SkillId, m_CurrentCooldown);
@@ -72,7 +74,7 @@ void Skill::Update(float deltaTime) {
         if (IsEnded()) {
             m_State = State::IDLE;
             LOG_DEBUG("Skill ended");
-            m_CurrentEffect = nullptr;
+            m_CurrentEffect.Clear();
         }
     }
 }
\ No newline at end of file